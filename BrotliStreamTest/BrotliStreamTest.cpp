@@ -0,0 +1,183 @@
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <brotli/decode.h>
+#include <brotli/encode.h>
+#include <spdlog/sinks/basic_file_sink.h>
+
+#include "Utilities/BrotliStream.h"
+
+std::shared_ptr<spdlog::logger> SHSELogger;
+
+// the stream buffers stage data in 64KB chunks, sizes either side of a chunk boundary are the interesting ones
+constexpr size_t ChunkSize = 64 * 1024;
+constexpr size_t LargeSize = 8 * 1024 * 1024;
+
+std::mt19937 generator(20210101);
+
+// cosave-like JSON text, compresses well
+std::string TextInput(const size_t length)
+{
+	std::uniform_real_distribution<float> coordinate(-100000.0f, 100000.0f);
+	std::ostringstream text;
+	size_t entry(0);
+	while (static_cast<size_t>(text.tellp()) < length)
+	{
+		text << "{\"time\":" << float(entry++) / 60.0f << ",\"worldspace\":\"0000003c\",\"position\":[" << coordinate(generator)
+			<< ',' << coordinate(generator) << ',' << coordinate(generator) << "]},";
+	}
+	return text.str().substr(0, length);
+}
+
+// incompressible
+std::string RandomInput(const size_t length)
+{
+	std::uniform_int_distribution<int> byte(0, 255);
+	std::string input(length, '\0');
+	for (char& c : input)
+	{
+		c = static_cast<char>(byte(generator));
+	}
+	return input;
+}
+
+std::string Compress(const std::string& input, const bool isText, const bool bytewise, bool& ok)
+{
+	std::string record;
+	CompressionUtils::BrotliOutputBuffer compressor(record, isText);
+	std::ostream plain(&compressor);
+	if (bytewise)
+	{
+		for (const char c : input)
+		{
+			plain.put(c);
+		}
+	}
+	else
+	{
+		plain.write(input.data(), static_cast<std::streamsize>(input.length()));
+	}
+	ok = plain.flush() && compressor.Finish() && compressor.PlainLength() == input.length();
+	return record;
+}
+
+std::string Inflate(const std::string& record, bool& failed, size_t& plainLength)
+{
+	CompressionUtils::BrotliInputBuffer inflater(record);
+	std::istream inflated(&inflater);
+	std::string output((std::istreambuf_iterator<char>(inflated)), std::istreambuf_iterator<char>());
+	failed = inflater.Failed();
+	plainLength = inflater.PlainLength();
+	return output;
+}
+
+// record layout written by the whole-buffer CompressionUtils::EncodeBrotli this stream replaced
+std::string CompressWholeBuffer(const std::string& input)
+{
+	size_t outputSize(BrotliEncoderMaxCompressedSize(input.length()));
+	std::string encoded(outputSize + sizeof(size_t), '\0');
+	const size_t length(input.length());
+	std::copy_n(reinterpret_cast<const char*>(&length), sizeof(size_t), encoded.begin());
+	BrotliEncoderCompress(1, BROTLI_DEFAULT_WINDOW, BROTLI_MODE_TEXT, input.length(), reinterpret_cast<const uint8_t*>(input.data()),
+		&outputSize, reinterpret_cast<uint8_t*>(encoded.data() + sizeof(size_t)));
+	encoded.resize(outputSize + sizeof(size_t));
+	return encoded;
+}
+
+bool CheckRoundTrip(const std::string& name, const std::string& input, const bool isText)
+{
+	bool ok(true);
+	for (const bool bytewise : { false, true })
+	{
+		if (bytewise && input.length() > 4 * ChunkSize)
+			continue;
+		bool compressed(false);
+		const std::string record(Compress(input, isText, bytewise, compressed));
+		bool failed(false);
+		size_t plainLength(0);
+		const std::string output(Inflate(record, failed, plainLength));
+		if (!compressed || failed || plainLength != input.length() || output != input)
+		{
+			std::cerr << name << (bytewise ? " bytewise" : " block") << " round trip of " << input.length() << " bytes failed\n";
+			ok = false;
+		}
+	}
+	return ok;
+}
+
+bool CheckPredecessorRecord(const std::string& input)
+{
+	bool failed(false);
+	size_t plainLength(0);
+	const std::string output(Inflate(CompressWholeBuffer(input), failed, plainLength));
+	const bool ok(!failed && plainLength == input.length() && output == input);
+	std::cout << "Whole-buffer record of " << input.length() << " bytes " << (ok ? "inflated OK" : "FAILED") << '\n';
+	return ok;
+}
+
+// every cut of the record must be reported, not inflated as a short but plausible record
+bool CheckTruncation(const std::string& input)
+{
+	bool compressed(false);
+	const std::string record(Compress(input, true, false, compressed));
+	size_t rejected(0);
+	size_t checked(0);
+	const size_t stride(std::max(size_t(1), record.length() / 499));
+	for (size_t length = 0; length < record.length(); length += stride)
+	{
+		++checked;
+		bool failed(false);
+		size_t plainLength(0);
+		Inflate(record.substr(0, length), failed, plainLength);
+		if (failed)
+		{
+			++rejected;
+		}
+		else
+		{
+			std::cerr << "Record truncated to " << length << " of " << record.length() << " bytes was not rejected\n";
+		}
+	}
+	std::cout << "Truncation: " << rejected << " of " << checked << " cuts rejected\n";
+	return compressed && rejected == checked;
+}
+
+template <typename F>
+long long TimeMicroseconds(F&& work)
+{
+	const auto startTime(std::chrono::high_resolution_clock::now());
+	work();
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - startTime).count();
+}
+
+void CompareWholeBuffer(const std::string& input)
+{
+	std::string wholeRecord;
+	const long long wholeTime(TimeMicroseconds([&]() { wholeRecord = CompressWholeBuffer(input); }));
+	std::string streamRecord;
+	bool compressed(false);
+	const long long streamTime(TimeMicroseconds([&]() { streamRecord = Compress(input, true, false, compressed); }));
+	std::cout << input.length() << " bytes of text: whole-buffer " << wholeRecord.length() << " bytes in " << wholeTime
+		<< " us, streamed " << streamRecord.length() << " bytes in " << streamTime << " us\n";
+}
+
+int main(int argc, const char** argv)
+{
+	SHSELogger = spdlog::basic_logger_mt("BrotliStreamTest", "BrotliStreamTest.log", true);
+	bool ok(true);
+	for (const size_t length : { size_t(0), size_t(1), ChunkSize - 1, ChunkSize, ChunkSize + 1, 3 * ChunkSize + 7, LargeSize })
+	{
+		ok = CheckRoundTrip("Text", TextInput(length), true) && ok;
+		ok = CheckRoundTrip("Random", RandomInput(length), false) && ok;
+	}
+	std::cout << "Round trips " << (ok ? "OK" : "FAILED") << '\n';
+	ok = CheckPredecessorRecord(TextInput(3 * ChunkSize + 7)) && ok;
+	ok = CheckTruncation(TextInput(LargeSize / 4)) && ok;
+	CompareWholeBuffer(TextInput(LargeSize));
+	std::cout << (ok ? "All checks passed\n" : "Checks FAILED\n");
+	return ok ? 0 : 1;
+}
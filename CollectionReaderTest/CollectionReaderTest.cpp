@@ -0,0 +1,438 @@
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <regex>
+
+#include "nlohmann/json-schema.hpp"
+
+#include "Collections/CollectionReader.h"
+#include "Looting/NPCFilterReader.h"
+
+// Compares the single-pass definition readers with the DOM path they replaced: nlohmann DOM parse, json-schema-validator
+// against the shipped schema, then a walk of the tree as in JsonTest. Both must accept and reject the same documents and
+// see the same content. Run from the solution directory, or pass its path.
+constexpr size_t Repeats = 50;
+
+// what a reader or walk saw, for comparing the two paths
+struct DefinitionCounts {
+	size_t m_collections = 0;
+	size_t m_filters = 0;
+	size_t m_conditions = 0;
+	size_t m_policies = 0;
+	size_t m_values = 0;
+
+	bool operator==(const DefinitionCounts& rhs) const = default;
+};
+
+std::ostream& operator<<(std::ostream& os, const DefinitionCounts& counts)
+{
+	return os << counts.m_collections << " collections, " << counts.m_filters << " filters, " << counts.m_conditions <<
+		" conditions, " << counts.m_policies << " policies, " << counts.m_values << " values";
+}
+
+size_t CountForms(const shse::FormsDefinition& forms)
+{
+	size_t values(0);
+	for (const auto& entry : forms)
+	{
+		values += entry.second.size();
+	}
+	return values;
+}
+
+void CountCondition(const size_t values, DefinitionCounts& counts)
+{
+	if (values == 0)
+		return;
+	++counts.m_conditions;
+	counts.m_values += values;
+}
+
+void CountFilter(const shse::FilterDefinition& filter, DefinitionCounts& counts)
+{
+	++counts.m_filters;
+	CountCondition(filter.m_plugins.size(), counts);
+	CountCondition(filter.m_formLists.size(), counts);
+	CountCondition(CountForms(filter.m_forms), counts);
+	CountCondition(filter.m_keywords.size(), counts);
+	CountCondition(filter.m_signatures.size(), counts);
+	CountCondition(filter.m_scopes.size(), counts);
+	if (filter.m_nameMatch)
+		CountCondition(filter.m_nameMatch->m_names.size(), counts);
+	for (const auto& subFilter : filter.m_subFilters)
+	{
+		CountFilter(subFilter, counts);
+	}
+}
+
+DefinitionCounts CountCollectionGroup(const shse::CollectionGroupDefinition& group)
+{
+	DefinitionCounts counts;
+	counts.m_policies = 1;
+	for (const auto& collection : group.m_collections)
+	{
+		++counts.m_collections;
+		if (collection.m_policy)
+			++counts.m_policies;
+		if (collection.m_rootFilter)
+			CountFilter(*collection.m_rootFilter, counts);
+		CountCondition(collection.m_categories.size(), counts);
+	}
+	return counts;
+}
+
+DefinitionCounts CountNPCFilters(const shse::NPCFilterDefinition& filters)
+{
+	DefinitionCounts counts;
+	counts.m_policies = 1;
+	for (const auto& filter : filters.m_orderedFilters)
+	{
+		++counts.m_filters;
+		for (const auto* match : { &filter.m_include, &filter.m_exclude })
+		{
+			counts.m_values += CountForms(match->m_races) + CountForms(match->m_factions) + match->m_keywords.size();
+		}
+	}
+	return counts;
+}
+
+void WalkFilter(const nlohmann::json& filter, DefinitionCounts& counts)
+{
+	++counts.m_filters;
+	for (const auto& condition : filter["condition"].items())
+	{
+		if (condition.key() == "subFilter")
+		{
+			for (const auto& subFilter : condition.value())
+			{
+				WalkFilter(subFilter, counts);
+			}
+			continue;
+		}
+		if (condition.key() == "forms")
+		{
+			++counts.m_conditions;
+			for (const auto& entry : condition.value())
+			{
+				counts.m_values += entry["form"].size();
+			}
+		}
+		else if (condition.key() == "nameMatch")
+		{
+			++counts.m_conditions;
+			counts.m_values += condition.value()["names"].size();
+		}
+		else if (condition.key() == "plugin" || condition.key() == "formList" || condition.key() == "keyword" ||
+			condition.key() == "signature" || condition.key() == "scope")
+		{
+			++counts.m_conditions;
+			counts.m_values += condition.value().size();
+		}
+	}
+}
+
+DefinitionCounts WalkCollectionGroup(const nlohmann::json& group)
+{
+	DefinitionCounts counts;
+	counts.m_policies = 1;
+	for (const auto& collection : group["collections"])
+	{
+		++counts.m_collections;
+		if (collection.contains("policy"))
+			++counts.m_policies;
+		if (collection.contains("rootFilter"))
+		{
+			WalkFilter(collection["rootFilter"], counts);
+		}
+		else
+		{
+			++counts.m_conditions;
+			counts.m_values += collection["category"].size();
+		}
+	}
+	return counts;
+}
+
+DefinitionCounts WalkNPCFilters(const nlohmann::json& filters)
+{
+	DefinitionCounts counts;
+	counts.m_policies = 1;
+	for (const auto& filter : filters["npc"]["orderedFilter"])
+	{
+		++counts.m_filters;
+		for (const char* matchName : { "include", "exclude" })
+		{
+			if (!filter.contains(matchName))
+				continue;
+			const nlohmann::json& match(filter[matchName]);
+			for (const char* formsName : { "race", "faction" })
+			{
+				if (!match.contains(formsName))
+					continue;
+				for (const auto& entry : match[formsName])
+				{
+					counts.m_values += entry["form"].size();
+				}
+			}
+			if (match.contains("keyword"))
+				counts.m_values += match["keyword"].size();
+		}
+	}
+	return counts;
+}
+
+struct Verdict {
+	bool m_accepted;
+	DefinitionCounts m_counts;
+	std::string m_error;
+};
+
+Verdict DOMVerdict(const std::string& text, const nlohmann::json_schema::json_validator& validator,
+	DefinitionCounts (*walk)(const nlohmann::json&))
+{
+	try {
+		const nlohmann::json document(nlohmann::json::parse(text));
+		validator.validate(document);
+		return { true, walk(document), std::string() };
+	}
+	catch (const std::exception& e) {
+		return { false, DefinitionCounts(), e.what() };
+	}
+}
+
+Verdict CollectionReaderVerdict(const std::string& text)
+{
+	try {
+		return { true, CountCollectionGroup(shse::ReadCollectionGroupDefinition(text)), std::string() };
+	}
+	catch (const std::exception& e) {
+		return { false, DefinitionCounts(), e.what() };
+	}
+}
+
+Verdict NPCFilterReaderVerdict(const std::string& text)
+{
+	try {
+		return { true, CountNPCFilters(shse::ReadNPCFilterDefinition(text)), std::string() };
+	}
+	catch (const std::exception& e) {
+		return { false, DefinitionCounts(), e.what() };
+	}
+}
+
+bool SameVerdict(const std::string& name, const Verdict& dom, const Verdict& reader)
+{
+	const bool same(dom.m_accepted == reader.m_accepted && dom.m_counts == reader.m_counts);
+	std::cout << name << ": " << (dom.m_accepted ? "accepted" : "rejected") << " by DOM, " <<
+		(reader.m_accepted ? "accepted" : "rejected") << " by reader" << (same ? "" : " - MISMATCH") << '\n';
+	if (!same)
+	{
+		std::cout << "  DOM " << dom.m_counts << (dom.m_error.empty() ? "" : ", ") << dom.m_error << '\n';
+		std::cout << "  reader " << reader.m_counts << (reader.m_error.empty() ? "" : ", ") << reader.m_error << '\n';
+	}
+	else if (!reader.m_accepted)
+	{
+		std::cout << "  " << reader.m_error << '\n';
+	}
+	return same;
+}
+
+std::string ReadText(const std::filesystem::path& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+bool LoadValidator(const std::filesystem::path& schemaPath, nlohmann::json_schema::json_validator& validator)
+{
+	try {
+		validator.set_root_schema(nlohmann::json::parse(ReadText(schemaPath)));
+		return true;
+	}
+	catch (const std::exception& e) {
+		std::cerr << "JSON Schema " << schemaPath.string() << " not loadable\n" << e.what() << '\n';
+		return false;
+	}
+}
+
+// Valid group using every kind of condition, the base for the schema rule cases
+const char* BaseGroup = R"({
+	"groupPolicy": { "action": "glow", "notify": true, "repeat": false },
+	"useMCM": true,
+	"collections": [
+		{
+			"name": "Filtered", "description": "every condition",
+			"policy": { "action": "take", "notify": false, "repeat": true },
+			"rootFilter": { "operator": "AND", "condition": {
+				"plugin": [ "Skyrim.esm" ], "keyword": [ "VendorItemGem" ], "signature": [ "MISC" ], "scope": [ "container" ],
+				"formList": [ { "listPlugin": "Skyrim.esm", "formID": "0001A2B3" } ],
+				"nameMatch": { "isNPC": false, "matchIf": "contains", "names": [ "Ring" ] },
+				"subFilter": [ { "operator": "OR", "condition": { "forms": [ { "plugin": "Skyrim.esm", "form": [ "00012345" ] } ] } } ]
+			} }
+		},
+		{ "name": "Category", "description": "by category", "category": [ "book", "weapon" ] }
+	]
+})";
+
+const char* BaseNPCFilters = R"({
+	"npc": {
+		"defaultLoot": false, "excludePlayerRace": true,
+		"orderedFilter": [
+			{ "priority": 1, "exclude": { "race": [ { "plugin": "Skyrim.esm", "form": [ "000131F9" ] } ], "keyword": [ "ActorTypeNPC" ] } },
+			{ "priority": 2, "include": { "faction": [ { "plugin": "Skyrim.esm", "form": [ "00032D9C" ] } ] } }
+		]
+	}
+})";
+
+// JSON Patch edits of the base documents, each probing one schema rule
+const std::vector<std::pair<const char*, const char*>> GroupCases = {
+	{ "base", "[]" },
+	{ "unknown members skipped", R"([{ "op": "add", "path": "/$comment", "value": { "nested": [ 1, null, 2.5 ] } },
+		{ "op": "add", "path": "/collections/0/rootFilter/condition/extra", "value": [ { "a": "b" } ] }])" },
+	{ "no groupPolicy", R"([{ "op": "remove", "path": "/groupPolicy" }])" },
+	{ "no useMCM", R"([{ "op": "remove", "path": "/useMCM" }])" },
+	{ "no collections", R"([{ "op": "remove", "path": "/collections" }])" },
+	{ "empty collections", R"([{ "op": "replace", "path": "/collections", "value": [] }])" },
+	{ "useMCM string", R"([{ "op": "replace", "path": "/useMCM", "value": "yes" }])" },
+	{ "useMCM float", R"([{ "op": "replace", "path": "/useMCM", "value": 1.0 }])" },
+	{ "bad action", R"([{ "op": "replace", "path": "/groupPolicy/action", "value": "burn" }])" },
+	{ "policy without notify", R"([{ "op": "remove", "path": "/collections/0/policy/notify" }])" },
+	{ "policy repeat string", R"([{ "op": "replace", "path": "/collections/0/policy/repeat", "value": "true" }])" },
+	{ "collection without name", R"([{ "op": "remove", "path": "/collections/1/name" }])" },
+	{ "collection name number", R"([{ "op": "replace", "path": "/collections/1/name", "value": 7 }])" },
+	{ "rootFilter and category", R"([{ "op": "add", "path": "/collections/1/rootFilter", "value": { "operator": "OR", "condition": { "plugin": [ "a.esp" ] } } }])" },
+	{ "neither rootFilter nor category", R"([{ "op": "remove", "path": "/collections/1/category" }])" },
+	{ "bad category", R"([{ "op": "add", "path": "/collections/1/category/-", "value": "potion" }])" },
+	{ "duplicate category", R"([{ "op": "add", "path": "/collections/1/category/-", "value": "book" }])" },
+	{ "empty category", R"([{ "op": "replace", "path": "/collections/1/category", "value": [] }])" },
+	{ "bad operator", R"([{ "op": "replace", "path": "/collections/0/rootFilter/operator", "value": "NOT" }])" },
+	{ "filter without condition", R"([{ "op": "remove", "path": "/collections/0/rootFilter/condition" }])" },
+	{ "empty condition", R"([{ "op": "replace", "path": "/collections/0/rootFilter/condition", "value": {} }])" },
+	{ "scope only", R"([{ "op": "replace", "path": "/collections/0/rootFilter/condition", "value": { "scope": [ "deadBody" ] } }])" },
+	{ "forms with plugin", R"([{ "op": "add", "path": "/collections/0/rootFilter/condition/forms", "value": [ { "plugin": "a.esp", "form": [ "00000001" ] } ] },
+		{ "op": "remove", "path": "/collections/0/rootFilter/condition/nameMatch" }])" },
+	{ "forms with nameMatch", R"([{ "op": "replace", "path": "/collections/0/rootFilter/condition", "value": {
+		"forms": [ { "plugin": "a.esp", "form": [ "00000001" ] } ], "nameMatch": { "isNPC": true, "matchIf": "equals", "names": [ "Bob" ] } } }])" },
+	{ "duplicate plugin", R"([{ "op": "add", "path": "/collections/0/rootFilter/condition/plugin/-", "value": "Skyrim.esm" }])" },
+	{ "17 plugins", R"([{ "op": "replace", "path": "/collections/0/rootFilter/condition/plugin", "value":
+		[ "1", "2", "3", "4", "5", "6", "7", "8", "9", "10", "11", "12", "13", "14", "15", "16", "17" ] }])" },
+	{ "null plugin", R"([{ "op": "add", "path": "/collections/0/rootFilter/condition/plugin/-", "value": null }])" },
+	{ "bad signature", R"([{ "op": "add", "path": "/collections/0/rootFilter/condition/signature/-", "value": "FOOD" }])" },
+	{ "three scopes", R"([{ "op": "replace", "path": "/collections/0/rootFilter/condition/scope", "value": [ "deadBody", "container", "looseItem" ] }])" },
+	{ "bad FormList formID", R"([{ "op": "replace", "path": "/collections/0/rootFilter/condition/formList/0/formID", "value": "0001A2BZ" }])" },
+	{ "embedded formID", R"([{ "op": "replace", "path": "/collections/0/rootFilter/condition/formList/0/formID", "value": "0x0001A2B3" }])" },
+	{ "formID with spaces", R"([{ "op": "replace", "path": "/collections/0/rootFilter/condition/formList/0/formID", "value": "0001 A2B" }])" },
+	{ "duplicate FormList", R"([{ "op": "add", "path": "/collections/0/rootFilter/condition/formList/-", "value": { "listPlugin": "Skyrim.esm", "formID": "0001A2B3" } }])" },
+	{ "FormList without plugin", R"([{ "op": "remove", "path": "/collections/0/rootFilter/condition/formList/0/listPlugin" }])" },
+	{ "bad forms formID", R"([{ "op": "add", "path": "/collections/0/rootFilter/condition/subFilter/0/condition/forms/0/form/-", "value": "12345" }])" },
+	{ "duplicate forms formID", R"([{ "op": "add", "path": "/collections/0/rootFilter/condition/subFilter/0/condition/forms/0/form/-", "value": "00012345" }])" },
+	{ "forms without form", R"([{ "op": "remove", "path": "/collections/0/rootFilter/condition/subFilter/0/condition/forms/0/form" }])" },
+	{ "empty subFilter", R"([{ "op": "replace", "path": "/collections/0/rootFilter/condition/subFilter", "value": [] }])" },
+	{ "subFilter not object", R"([{ "op": "add", "path": "/collections/0/rootFilter/condition/subFilter/-", "value": "AND" }])" },
+	{ "nameMatch without names", R"([{ "op": "remove", "path": "/collections/0/rootFilter/condition/nameMatch/names" }])" },
+	{ "bad matchIf", R"([{ "op": "replace", "path": "/collections/0/rootFilter/condition/nameMatch/matchIf", "value": "like" }])" },
+	{ "isNPC string", R"([{ "op": "replace", "path": "/collections/0/rootFilter/condition/nameMatch/isNPC", "value": "false" }])" },
+};
+
+const std::vector<std::pair<const char*, const char*>> NPCFilterCases = {
+	{ "base", "[]" },
+	{ "no npc", R"([{ "op": "remove", "path": "/npc" }])" },
+	{ "no defaultLoot", R"([{ "op": "remove", "path": "/npc/defaultLoot" }])" },
+	{ "empty orderedFilter", R"([{ "op": "replace", "path": "/npc/orderedFilter", "value": [] }])" },
+	{ "priority string", R"([{ "op": "replace", "path": "/npc/orderedFilter/0/priority", "value": "1" }])" },
+	{ "no priority", R"([{ "op": "remove", "path": "/npc/orderedFilter/1/priority" }])" },
+	{ "neither include nor exclude", R"([{ "op": "remove", "path": "/npc/orderedFilter/1/include" }])" },
+	{ "empty match", R"([{ "op": "replace", "path": "/npc/orderedFilter/1/include", "value": {} }])" },
+	{ "duplicate race forms allowed", R"([{ "op": "add", "path": "/npc/orderedFilter/0/exclude/race/-", "value": { "plugin": "Skyrim.esm", "form": [ "000131F9" ] } }])" },
+	{ "bad race formID", R"([{ "op": "replace", "path": "/npc/orderedFilter/0/exclude/race/0/form/0", "value": "131F9" }])" },
+};
+
+bool CheckCases(const char* base, const std::vector<std::pair<const char*, const char*>>& cases,
+	const nlohmann::json_schema::json_validator& validator, DefinitionCounts (*walk)(const nlohmann::json&),
+	Verdict (*read)(const std::string&))
+{
+	bool ok(true);
+	const nlohmann::json baseDocument(nlohmann::json::parse(base));
+	for (const auto& testCase : cases)
+	{
+		const std::string text(baseDocument.patch(nlohmann::json::parse(testCase.second)).dump(1, '\t'));
+		ok = SameVerdict(testCase.first, DOMVerdict(text, validator, walk), read(text)) && ok;
+	}
+	// not JSON, or not the top-level object the schemas require
+	for (const std::string& text : { std::string(base).substr(0, std::string(base).size() / 2), std::string("[]"), std::string("\"x\"") })
+	{
+		ok = SameVerdict("malformed " + text.substr(0, 8), DOMVerdict(text, validator, walk), read(text)) && ok;
+	}
+	return ok;
+}
+
+template <typename F>
+long long MeanMicroseconds(F&& work)
+{
+	const auto startTime(std::chrono::high_resolution_clock::now());
+	for (size_t repeat = 0; repeat < Repeats; ++repeat)
+	{
+		work();
+	}
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - startTime).count() / Repeats;
+}
+
+bool CheckFile(const std::string& name, const std::string& text, const nlohmann::json_schema::json_validator& validator,
+	DefinitionCounts (*walk)(const nlohmann::json&), Verdict (*read)(const std::string&))
+{
+	const Verdict dom(DOMVerdict(text, validator, walk));
+	const Verdict reader(read(text));
+	const bool ok(SameVerdict(name, dom, reader));
+	if (ok && reader.m_accepted)
+	{
+		const long long domTime(MeanMicroseconds([&]() { DOMVerdict(text, validator, walk); }));
+		const long long readerTime(MeanMicroseconds([&]() { read(text); }));
+		std::cout << "  " << text.size() << " bytes, " << reader.m_counts << ": DOM parse, validate and walk " << domTime <<
+			" us, single pass " << readerTime << " us\n";
+	}
+	return ok;
+}
+
+int main(int argc, const char** argv)
+{
+	const std::filesystem::path root(argc > 1 ? argv[1] : ".");
+	nlohmann::json_schema::json_validator collectionsValidator;
+	nlohmann::json_schema::json_validator filtersValidator;
+	if (!LoadValidator(root / "Collections" / "Schema" / "SHSE.SchemaCollections.json", collectionsValidator) ||
+		!LoadValidator(root / "Filters" / "SHSE.SchemaFilters.json", filtersValidator))
+	{
+		return 1;
+	}
+
+	bool ok(CheckCases(BaseGroup, GroupCases, collectionsValidator, WalkCollectionGroup, CollectionReaderVerdict));
+	ok = CheckCases(BaseNPCFilters, NPCFilterCases, filtersValidator, WalkNPCFilters, NPCFilterReaderVerdict) && ok;
+
+	const std::regex collectionsFilePattern("SHSE\\.Collections\\..*\\.json$");
+	std::string largest;
+	for (const auto& nextFile : std::filesystem::directory_iterator(root / "Collections" / "Examples"))
+	{
+		const std::string fileName(nextFile.path().filename().string());
+		if (!std::regex_search(fileName, collectionsFilePattern))
+			continue;
+		const std::string text(ReadText(nextFile.path()));
+		ok = CheckFile(fileName, text, collectionsValidator, WalkCollectionGroup, CollectionReaderVerdict) && ok;
+		if (text.size() > largest.size())
+			largest = text;
+	}
+	// largest example grown to the schema's limit of 128 Collections
+	nlohmann::json scaled(nlohmann::json::parse(largest));
+	const nlohmann::json collections(scaled["collections"]);
+	for (size_t next = 0; !collections.empty() && scaled["collections"].size() < 128; ++next)
+	{
+		nlohmann::json collection(collections[next % collections.size()]);
+		collection["name"] = collection["name"].get<std::string>() + " " + std::to_string(next);
+		scaled["collections"].push_back(collection);
+	}
+	ok = CheckFile("largest example x128", scaled.dump(2), collectionsValidator, WalkCollectionGroup, CollectionReaderVerdict) && ok;
+	ok = CheckFile("SHSE.Filter.DeadBody.json", ReadText(root / "Filters" / "SHSE.Filter.DeadBody.json"),
+		filtersValidator, WalkNPCFilters, NPCFilterReaderVerdict) && ok;
+
+	std::cout << (ok ? "All checks passed\n" : "Checks FAILED\n");
+	return ok ? 0 : 1;
+}
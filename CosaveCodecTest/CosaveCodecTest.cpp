@@ -0,0 +1,343 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+
+#include "nlohmann/json.hpp"
+#include <spdlog/sinks/basic_file_sink.h>
+
+#include "Data/CosaveCodec.h"
+#include "Utilities/BrotliStream.h"
+
+std::shared_ptr<spdlog::logger> SHSELogger;
+
+// Synthetic long playthrough: a season of game days at a steady rate of travel, collecting and fighting
+constexpr size_t GameDays = 400;
+constexpr size_t VisitsPerDay = 60;
+constexpr size_t CollectionGroups = 6;
+constexpr size_t CollectionsPerGroup = 40;
+constexpr size_t MembersPerCollection = 60;
+constexpr size_t PartyUpdates = 300;
+constexpr size_t Victims = 6000;
+constexpr size_t Plugins = 250;
+
+std::mt19937 generator(20210101);
+
+std::string FormIDString(const uint32_t formID)
+{
+	std::ostringstream ss;
+	ss << std::hex << std::setw(8) << std::setfill('0') << formID;
+	return ss.str();
+}
+
+std::string RandomFormID()
+{
+	std::uniform_int_distribution<uint32_t> plugin(0, Plugins - 1);
+	std::uniform_int_distribution<uint32_t> local(0x800, 0xffffff);
+	return FormIDString((plugin(generator) << 24) | local(generator));
+}
+
+nlohmann::json LoadOrderRecord()
+{
+	nlohmann::json j;
+	j["priority"] = 123;
+	j["order"] = nlohmann::json::array();
+	for (uint32_t plugin = 0; plugin < Plugins; ++plugin)
+	{
+		nlohmann::json entry;
+		entry["formIDMask"] = FormIDString(plugin << 24);
+		entry["priority"] = int(plugin);
+		entry["name"] = "Plugin" + std::to_string(plugin) + ".esp";
+		j["order"].push_back(entry);
+	}
+	return j;
+}
+
+nlohmann::json VisitedPlacesRecord()
+{
+	std::uniform_int_distribution<uint32_t> locations(0, 400);
+	std::uniform_real_distribution<float> step(-2000.0f, 2000.0f);
+	std::uniform_int_distribution<int> inLocation(0, 2);
+	nlohmann::json j;
+	j["visited"] = nlohmann::json::array();
+	std::array<float, 3> position({ 0.0f, 0.0f, 0.0f });
+	for (size_t day = 0; day < GameDays; ++day)
+	{
+		for (size_t visit = 0; visit < VisitsPerDay; ++visit)
+		{
+			nlohmann::json place;
+			place["time"] = float(day) + float(visit) / float(VisitsPerDay);
+			place["worldspace"] = FormIDString(0x3c);
+			if (inLocation(generator) > 0)
+			{
+				place["location"] = FormIDString(0x10000 + locations(generator));
+			}
+			place["cell"] = RandomFormID();
+			for (float& axis : position)
+			{
+				axis += step(generator);
+			}
+			place["position"] = position;
+			j["visited"].push_back(place);
+		}
+	}
+	return j;
+}
+
+nlohmann::json CollectionsRecord()
+{
+	std::uniform_real_distribution<float> observed(0.0f, float(GameDays));
+	std::uniform_int_distribution<int> collected(0, 3);
+	nlohmann::json j;
+	j["groups"] = nlohmann::json::array();
+	for (size_t group = 0; group < CollectionGroups; ++group)
+	{
+		nlohmann::json groupState;
+		groupState["name"] = "Group " + std::to_string(group);
+		groupState["groupPolicy"] = { { "action", "take" }, { "notify", true }, { "repeat", false } };
+		groupState["useMCM"] = group % 2 == 0;
+		groupState["collectionState"] = nlohmann::json::array();
+		for (size_t collection = 0; collection < CollectionsPerGroup; ++collection)
+		{
+			nlohmann::json collectionState;
+			collectionState["name"] = "Collection " + std::to_string(collection);
+			collectionState["description"] = "Synthetic collection for codec measurement";
+			collectionState["members"] = nlohmann::json::array();
+			for (size_t member = 0; member < MembersPerCollection; ++member)
+			{
+				if (collected(generator) > 0)
+					continue;
+				collectionState["members"].push_back({ { "form", RandomFormID() }, { "time", observed(generator) } });
+			}
+			groupState["collectionState"].push_back(collectionState);
+		}
+		j["groups"].push_back(groupState);
+	}
+	return j;
+}
+
+nlohmann::json PartyRecord()
+{
+	std::uniform_int_distribution<int> eventType(0, 1);
+	nlohmann::json j;
+	j["updates"] = nlohmann::json::array();
+	for (size_t update = 0; update < PartyUpdates; ++update)
+	{
+		j["updates"].push_back({ { "follower", RandomFormID() }, { "event", eventType(generator) },
+			{ "time", float(update) * float(GameDays) / float(PartyUpdates) } });
+	}
+	j["followers"] = { RandomFormID(), RandomFormID() };
+	return j;
+}
+
+nlohmann::json VictimsRecord()
+{
+	static const std::array<const char*, 6> names({ "Bandit", "Draugr", "Wolf", "Skeever", "Frost Troll", "Vampire" });
+	std::uniform_int_distribution<size_t> name(0, names.size() - 1);
+	nlohmann::json j;
+	j["victims"] = nlohmann::json::array();
+	for (size_t victim = 0; victim < Victims; ++victim)
+	{
+		j["victims"].push_back({ { "name", names[name(generator)] }, { "time", float(victim) * float(GameDays) / float(Victims) } });
+	}
+	return j;
+}
+
+// values a subsystem might write that the record generators above do not exercise
+nlohmann::json EdgeCaseRecord()
+{
+	nlohmann::json j;
+	j["null"] = nullptr;
+	j["flags"] = { true, false };
+	j["integers"] = { 0, -1, 127, 128, -129, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max() };
+	j["unsigned"] = std::numeric_limits<uint64_t>::max();
+	j["double"] = 0.1;
+	j["float"] = 0.5;
+	j["notFormID"] = { "0000003C", "3c", "0000003g", "" };
+	j["nested"] = { { 1, { 2, { 3 } } }, nlohmann::json::object(), nlohmann::json::array() };
+	// objects with missing and differently-typed fields
+	j["sparse"] = { { { "a", 1 } }, { { "b", "x" } }, { { "a", "y" }, { "b", 2.5 } }, nlohmann::json::object() };
+	return j;
+}
+
+std::string EncodePlain(const nlohmann::json& j)
+{
+	std::stringbuf encoded;
+	shse::CosaveCodec::Encode(j, encoded);
+	return encoded.str();
+}
+
+nlohmann::json DecodePlain(const std::string& plain, const size_t length)
+{
+	std::stringbuf encoded(plain);
+	return shse::CosaveCodec::Decode(encoded, length);
+}
+
+template <typename F>
+long long TimeMicroseconds(F&& work)
+{
+	const auto startTime(std::chrono::high_resolution_clock::now());
+	work();
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - startTime).count();
+}
+
+// Compare the version 1 record (brotli JSON text) with version 2 (brotli CosaveCodec binary) and check the binary
+// round trip is lossless
+bool CheckRecord(const std::string& name, const nlohmann::json& state)
+{
+	std::string textRecord;
+	size_t textPlain(0);
+	const long long textEncodeTime(TimeMicroseconds([&]() {
+		CompressionUtils::BrotliOutputBuffer compressor(textRecord, true);
+		std::ostream plain(&compressor);
+		plain << state;
+		plain.flush();
+		compressor.Finish();
+		textPlain = compressor.PlainLength();
+	}));
+	nlohmann::json fromText;
+	const long long textDecodeTime(TimeMicroseconds([&]() {
+		CompressionUtils::BrotliInputBuffer inflater(textRecord);
+		std::istream inflated(&inflater);
+		fromText = nlohmann::json::parse(inflated);
+	}));
+
+	std::string binaryRecord;
+	size_t binaryPlain(0);
+	const long long binaryEncodeTime(TimeMicroseconds([&]() {
+		CompressionUtils::BrotliOutputBuffer compressor(binaryRecord, false);
+		shse::CosaveCodec::Encode(state, compressor);
+		compressor.Finish();
+		binaryPlain = compressor.PlainLength();
+	}));
+	nlohmann::json fromBinary;
+	bool inflateFailed(false);
+	const long long binaryDecodeTime(TimeMicroseconds([&]() {
+		CompressionUtils::BrotliInputBuffer inflater(binaryRecord);
+		fromBinary = shse::CosaveCodec::Decode(inflater, inflater.PlainLength());
+		inflateFailed = inflater.Failed();
+	}));
+
+	std::cout << name << " v1 JSON " << textPlain << " bytes, " << textRecord.length() << " compressed, encode "
+		<< textEncodeTime << " us, decode " << textDecodeTime << " us\n";
+	std::cout << name << " v2 binary " << binaryPlain << " bytes, " << binaryRecord.length() << " compressed, encode "
+		<< binaryEncodeTime << " us, decode " << binaryDecodeTime << " us\n";
+	bool ok(true);
+	if (fromText != state)
+	{
+		std::cerr << name << " v1 round trip mismatch\n";
+		ok = false;
+	}
+	if (inflateFailed || fromBinary != state)
+	{
+		std::cerr << name << " v2 round trip mismatch\n";
+		ok = false;
+	}
+	return ok;
+}
+
+// a record cut short at any point must be rejected, never decoded as something else
+bool CheckTruncation(const std::string& name, const nlohmann::json& state)
+{
+	const std::string plain(EncodePlain(state));
+	size_t rejected(0);
+	size_t checked(0);
+	const size_t stride(std::max(size_t(1), plain.length() / 251));
+	for (size_t length = 0; length < plain.length(); length += stride)
+	{
+		++checked;
+		try {
+			// record claims its full length but the data ends early
+			DecodePlain(plain.substr(0, length), plain.length());
+		}
+		catch (const std::runtime_error&) {
+			++rejected;
+			continue;
+		}
+		std::cerr << name << " truncated to " << length << " of " << plain.length() << " bytes was not rejected\n";
+	}
+	// trailing data after a complete value
+	bool trailingRejected(false);
+	try {
+		DecodePlain(plain + '\0', plain.length() + 1);
+	}
+	catch (const std::runtime_error&) {
+		trailingRejected = true;
+	}
+	// a truncated compressed record must fail to inflate
+	std::string compressedRecord;
+	{
+		CompressionUtils::BrotliOutputBuffer compressor(compressedRecord, false);
+		shse::CosaveCodec::Encode(state, compressor);
+		compressor.Finish();
+	}
+	compressedRecord.resize(compressedRecord.length() / 2);
+	bool inflateRejected(false);
+	try {
+		CompressionUtils::BrotliInputBuffer inflater(compressedRecord);
+		shse::CosaveCodec::Decode(inflater, inflater.PlainLength());
+		inflateRejected = inflater.Failed();
+	}
+	catch (const std::runtime_error&) {
+		inflateRejected = true;
+	}
+	std::cout << name << " truncation: " << rejected << " of " << checked << " rejected, trailing data "
+		<< (trailingRejected ? "rejected" : "accepted") << ", truncated compressed record "
+		<< (inflateRejected ? "rejected" : "accepted") << '\n';
+	return rejected == checked && trailingRejected && inflateRejected;
+}
+
+// a record of nested arrays, 2 bytes per level, must be rejected rather than recursed into until the stack overflows
+bool CheckNesting()
+{
+	constexpr size_t Levels = 1000000;
+	// ValueTag::Array with one element, then ValueTag::Null innermost
+	std::string plain;
+	plain.reserve(Levels * 2 + 1);
+	for (size_t level = 0; level < Levels; ++level)
+	{
+		plain.push_back('\x09');
+		plain.push_back('\x01');
+	}
+	plain.push_back('\x00');
+	bool nestingRejected(false);
+	try {
+		DecodePlain(plain, plain.length());
+	}
+	catch (const std::runtime_error&) {
+		nestingRejected = true;
+	}
+	// the same shape a few levels deep is a valid record
+	nlohmann::json shallow(nullptr);
+	for (size_t level = 0; level < 8; ++level)
+	{
+		shallow = nlohmann::json::array({ shallow });
+	}
+	const bool shallowAccepted(DecodePlain(EncodePlain(shallow), EncodePlain(shallow).length()) == shallow);
+	std::cout << "nesting " << Levels << " levels " << (nestingRejected ? "rejected" : "accepted") << ", 8 levels "
+		<< (shallowAccepted ? "accepted" : "rejected") << '\n';
+	return nestingRejected && shallowAccepted;
+}
+
+int main(int argc, const char** argv)
+{
+	SHSELogger = spdlog::basic_logger_mt("CosaveCodecTest", "CosaveCodecTest.log", true);
+	const std::vector<std::pair<std::string, nlohmann::json>> records({
+		{ "LORD", LoadOrderRecord() },
+		{ "COLL", CollectionsRecord() },
+		{ "PLAC", VisitedPlacesRecord() },
+		{ "PRTY", PartyRecord() },
+		{ "VCTM", VictimsRecord() },
+		{ "EDGE", EdgeCaseRecord() }
+	});
+	bool ok(true);
+	for (const auto& record : records)
+	{
+		ok = CheckRecord(record.first, record.second) && ok;
+		ok = CheckTruncation(record.first, record.second) && ok;
+	}
+	ok = CheckNesting() && ok;
+	std::cout << (ok ? "All checks passed\n" : "Checks FAILED\n");
+	return ok ? 0 : 1;
+}
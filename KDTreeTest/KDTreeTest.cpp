@@ -0,0 +1,222 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "Utilities/KDTree.h"
+
+// Map-marker-like point sets in worldspace units, checked against brute force
+constexpr size_t Points = 3000;
+constexpr size_t Queries = 2000;
+constexpr float WorldExtent = 200000.0f;
+constexpr double Tolerance = 1e-3;
+
+std::mt19937 generator(20210101);
+
+typedef std::vector<std::pair<shse::KDTree::Point, shse::KDTree::Tag>> PointSet;
+
+PointSet UniformPoints(const size_t count)
+{
+	std::uniform_real_distribution<float> coordinate(-WorldExtent, WorldExtent);
+	std::uniform_real_distribution<float> height(-5000.0f, 20000.0f);
+	PointSet points;
+	for (size_t point = 0; point < count; ++point)
+	{
+		points.push_back({ { coordinate(generator), coordinate(generator), height(generator) }, shse::KDTree::Tag(point) });
+	}
+	return points;
+}
+
+// towns and dungeon clusters, with exact duplicates and a line of equal-x points to stress split ties
+PointSet AwkwardPoints(const size_t count)
+{
+	std::uniform_real_distribution<float> centre(-WorldExtent, WorldExtent);
+	std::normal_distribution<float> spread(0.0f, 500.0f);
+	PointSet points;
+	shse::KDTree::Point cluster({ 0.0f, 0.0f, 0.0f });
+	for (size_t point = 0; point < count; ++point)
+	{
+		if (point % 50 == 0)
+		{
+			cluster = { centre(generator), centre(generator), 0.0f };
+		}
+		shse::KDTree::Point next;
+		if (point % 7 == 0 && !points.empty())
+		{
+			next = points.back().first;
+		}
+		else if (point % 11 == 0)
+		{
+			next = { 1000.0f, float(point), 0.0f };
+		}
+		else
+		{
+			next = { cluster[0] + spread(generator), cluster[1] + spread(generator), spread(generator) };
+		}
+		points.push_back({ next, shse::KDTree::Tag(point) });
+	}
+	return points;
+}
+
+double Distance(const shse::KDTree::Point& lhs, const shse::KDTree::Point& rhs)
+{
+	double sum(0.0);
+	for (size_t axis = 0; axis < 3; ++axis)
+	{
+		const double delta(double(lhs[axis]) - double(rhs[axis]));
+		sum += delta * delta;
+	}
+	return std::sqrt(sum);
+}
+
+std::vector<double> BruteForceDistances(const PointSet& points, const shse::KDTree::Point& query, const shse::KDTree::Filter* accept)
+{
+	std::vector<double> distances;
+	for (const auto& point : points)
+	{
+		if (!accept || (*accept)(point.second))
+		{
+			distances.push_back(Distance(point.first, query));
+		}
+	}
+	std::sort(distances.begin(), distances.end());
+	return distances;
+}
+
+bool Near(const double lhs, const double rhs)
+{
+	return std::abs(lhs - rhs) <= Tolerance * std::max(1.0, std::max(std::abs(lhs), std::abs(rhs)));
+}
+
+// points tie on distance, so results are compared by distance sequence, and each result must be a real point
+bool Matches(const PointSet& points, const shse::KDTree::Point& query, const std::vector<shse::KDTree::Neighbour>& found,
+	const std::vector<double>& expected, const size_t expectedCount)
+{
+	if (found.size() != expectedCount)
+		return false;
+	for (size_t index = 0; index < found.size(); ++index)
+	{
+		const shse::KDTree::Neighbour& neighbour(found[index]);
+		if (neighbour.m_tag >= points.size() || points[neighbour.m_tag].first != neighbour.m_point)
+			return false;
+		if (!Near(neighbour.m_distance, expected[index]) || !Near(Distance(neighbour.m_point, query), expected[index]))
+			return false;
+	}
+	return true;
+}
+
+bool CheckPointSet(const std::string& name, const PointSet& points, const std::vector<shse::KDTree::Point>& queries)
+{
+	shse::KDTree tree;
+	tree.Build(points);
+	const shse::KDTree::Filter oddTags([](const shse::KDTree::Tag tag) -> bool { return tag % 2 == 1; });
+	const shse::KDTree::Filter rareTags([](const shse::KDTree::Tag tag) -> bool { return tag % 97 == 0; });
+	size_t failures(0);
+	for (const auto& query : queries)
+	{
+		const std::vector<double> all(BruteForceDistances(points, query, nullptr));
+		const std::optional<shse::KDTree::Neighbour> nearest(tree.Nearest(query));
+		if (points.empty() ? nearest.has_value() :
+			!nearest.has_value() || !Matches(points, query, { nearest.value() }, all, 1))
+		{
+			++failures;
+		}
+		for (const size_t k : { size_t(1), size_t(5), size_t(32), points.size() + 1 })
+		{
+			if (!Matches(points, query, tree.KNearest(query, k), all, std::min(k, all.size())))
+			{
+				++failures;
+			}
+			for (const shse::KDTree::Filter* filter : { &oddTags, &rareTags })
+			{
+				const std::vector<double> accepted(BruteForceDistances(points, query, filter));
+				if (!Matches(points, query, tree.KNearest(query, k, *filter), accepted, std::min(k, accepted.size())))
+				{
+					++failures;
+				}
+			}
+		}
+		for (const double radius : { 0.0, 1000.0, 25000.0 })
+		{
+			const size_t inside(std::upper_bound(all.cbegin(), all.cend(), radius) - all.cbegin());
+			const std::vector<shse::KDTree::Neighbour> found(tree.WithinRadius(query, radius));
+			// points at the boundary may fall either side after float rounding
+			const size_t boundary(std::count_if(all.cbegin(), all.cend(), [&](const double distance) { return Near(distance, radius); }));
+			if (found.size() + boundary < inside || found.size() > inside + boundary ||
+				!Matches(points, query, found, all, found.size()))
+			{
+				++failures;
+			}
+		}
+	}
+	std::cout << name << ": " << points.size() << " points, " << queries.size() << " queries, " << failures << " mismatches\n";
+	return failures == 0;
+}
+
+template <typename F>
+long long TimeMicroseconds(F&& work)
+{
+	const auto startTime(std::chrono::high_resolution_clock::now());
+	work();
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - startTime).count();
+}
+
+void CompareBruteForce(const PointSet& points, const std::vector<shse::KDTree::Point>& queries)
+{
+	shse::KDTree tree;
+	const long long buildTime(TimeMicroseconds([&]() { tree.Build(points); }));
+	double treeSum(0.0);
+	const long long treeTime(TimeMicroseconds([&]() {
+		for (const auto& query : queries)
+		{
+			treeSum += tree.KNearest(query, 5).back().m_distance;
+		}
+	}));
+	double bruteSum(0.0);
+	const long long bruteTime(TimeMicroseconds([&]() {
+		std::vector<double> distances(points.size());
+		for (const auto& query : queries)
+		{
+			std::transform(points.cbegin(), points.cend(), distances.begin(),
+				[&](const auto& point) { return Distance(point.first, query); });
+			std::nth_element(distances.begin(), distances.begin() + 4, distances.end());
+			bruteSum += *std::max_element(distances.begin(), distances.begin() + 5);
+		}
+	}));
+	std::cout << "5-nearest over " << points.size() << " points: build " << buildTime << " us, " << queries.size()
+		<< " queries k-d tree " << treeTime << " us, brute force " << bruteTime << " us"
+		<< (Near(treeSum, bruteSum) ? "" : ", RESULTS DIFFER") << '\n';
+}
+
+int main(int argc, const char** argv)
+{
+	std::vector<shse::KDTree::Point> queries;
+	for (const auto& point : UniformPoints(Queries))
+	{
+		queries.push_back(point.first);
+	}
+	const PointSet uniform(UniformPoints(Points));
+	const PointSet awkward(AwkwardPoints(Points));
+	// queries that land exactly on stored points
+	std::vector<shse::KDTree::Point> onPoints;
+	for (size_t point = 0; point < awkward.size(); point += 13)
+	{
+		onPoints.push_back(awkward[point].first);
+	}
+
+	bool ok(CheckPointSet("Empty", PointSet(), queries));
+	ok = CheckPointSet("Single", UniformPoints(1), queries) && ok;
+	ok = CheckPointSet("Small", UniformPoints(7), queries) && ok;
+	ok = CheckPointSet("Uniform", uniform, queries) && ok;
+	ok = CheckPointSet("Clustered", awkward, queries) && ok;
+	ok = CheckPointSet("Clustered, queries on points", awkward, onPoints) && ok;
+	CompareBruteForce(uniform, queries);
+	std::cout << (ok ? "All checks passed\n" : "Checks FAILED\n");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,179 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include "Data/KeywordMask.h"
+#include "Data/KeywordRows.h"
+
+// Synthetic load order: keyword-bearing forms carry a few of many keywords, and a minority of keywords is of interest
+// to Collection conditions, glowable books, category mappings and the NPC filter
+constexpr size_t AllKeywords = 4000;
+constexpr size_t RegisteredKeywords = 300;
+constexpr size_t Forms = 60000;
+constexpr size_t MaxKeywordsPerForm = 12;
+constexpr size_t Masks = 200;
+constexpr size_t MaxKeywordsPerMask = 8;
+constexpr int Passes = 5;
+
+struct SyntheticForm
+{
+	std::vector<size_t> m_keywords;
+};
+
+typedef shse::KeywordRows<size_t, const SyntheticForm*> SyntheticRows;
+
+// KeywordRows visits a form's keywords through a callable, as KeywordIndex does for BGSKeywordForm
+auto KeywordsOf(const SyntheticForm& form)
+{
+	return [&](auto&& visit) {
+		for (const size_t keyword : form.m_keywords)
+		{
+			visit(keyword);
+		}
+	};
+}
+
+// a load-order form of an indexed type with no row has no keywords of interest
+bool IndexedHasAny(const SyntheticRows& rows, const SyntheticForm& form, const shse::KeywordMask& mask)
+{
+	bool hasAny(false);
+	return rows.DeterminesMatch(&form, mask, hasAny) && hasAny;
+}
+
+// the predicate before indexing: walk the form's keywords, hash lookup per keyword
+bool WalkHasAny(const SyntheticForm& form, const std::unordered_set<size_t>& keywords)
+{
+	return std::any_of(form.m_keywords.cbegin(), form.m_keywords.cend(),
+		[&](const size_t keyword) { return keywords.contains(keyword); });
+}
+
+template <typename F>
+long long TimeMicroseconds(F&& work)
+{
+	const auto startTime(std::chrono::high_resolution_clock::now());
+	work();
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - startTime).count();
+}
+
+int main(int argc, const char** argv)
+{
+	std::mt19937 generator(20210101);
+	std::uniform_int_distribution<size_t> anyKeyword(0, AllKeywords - 1);
+
+	std::vector<size_t> registered(AllKeywords);
+	for (size_t keyword = 0; keyword < AllKeywords; ++keyword)
+	{
+		registered[keyword] = keyword;
+	}
+	std::shuffle(registered.begin(), registered.end(), generator);
+	registered.resize(RegisteredKeywords);
+
+	std::vector<SyntheticForm> forms(Forms);
+	std::uniform_int_distribution<size_t> keywordsPerForm(0, MaxKeywordsPerForm);
+	for (SyntheticForm& form : forms)
+	{
+		const size_t count(keywordsPerForm(generator));
+		for (size_t keyword = 0; keyword < count; ++keyword)
+		{
+			form.m_keywords.push_back(anyKeyword(generator));
+		}
+	}
+
+	SyntheticRows rows;
+	std::vector<shse::KeywordMask> masks(Masks);
+	std::vector<std::unordered_set<size_t>> maskKeywords(Masks);
+	std::uniform_int_distribution<size_t> keywordsPerMask(1, MaxKeywordsPerMask);
+	std::uniform_int_distribution<size_t> anyRegistered(0, RegisteredKeywords - 1);
+	for (size_t mask = 0; mask < Masks; ++mask)
+	{
+		const size_t count(keywordsPerMask(generator));
+		for (size_t keyword = 0; keyword < count; ++keyword)
+		{
+			const size_t chosen(registered[anyRegistered(generator)]);
+			masks[mask].Add(rows.Register(chosen).first);
+			maskKeywords[mask].insert(chosen);
+		}
+	}
+
+	const long long indexTime(TimeMicroseconds([&]() {
+		rows.Reset();
+		for (const SyntheticForm& form : forms)
+		{
+			rows.IndexForm(&form, KeywordsOf(form));
+		}
+	}));
+	std::cout << rows.Registered() << " KYWDs indexed for " << rows.IndexedForms() << " of " << Forms
+		<< " forms, " << rows.Bytes() << " bytes in " << indexTime << " microseconds\n";
+
+	size_t walkMatches(0);
+	size_t indexMatches(0);
+	size_t unindexedMatches(0);
+	long long walkTime(0);
+	long long maskTime(0);
+	long long unindexedTime(0);
+	for (int pass = 0; pass < Passes; ++pass)
+	{
+		walkMatches = 0;
+		indexMatches = 0;
+		walkTime += TimeMicroseconds([&]() {
+			for (size_t mask = 0; mask < Masks; ++mask)
+			{
+				for (const SyntheticForm& form : forms)
+				{
+					walkMatches += WalkHasAny(form, maskKeywords[mask]) ? 1 : 0;
+				}
+			}
+		});
+		maskTime += TimeMicroseconds([&]() {
+			for (size_t mask = 0; mask < Masks; ++mask)
+			{
+				for (const SyntheticForm& form : forms)
+				{
+					indexMatches += IndexedHasAny(rows, form, masks[mask]) ? 1 : 0;
+				}
+			}
+		});
+		// forms outside the index, such as dynamic forms, build their row on the fly
+		unindexedMatches = 0;
+		unindexedTime += TimeMicroseconds([&]() {
+			for (size_t mask = 0; mask < Masks; ++mask)
+			{
+				for (const SyntheticForm& form : forms)
+				{
+					unindexedMatches += rows.HasAnyUnindexed(KeywordsOf(form), masks[mask]) ? 1 : 0;
+				}
+			}
+		});
+	}
+
+	const size_t checks(Masks * Forms);
+	std::cout << checks << " keyword checks per pass, " << Passes << " passes\n";
+	std::cout << "Keyword walk: " << walkMatches << " matches, " << walkTime / Passes << " microseconds per pass\n";
+	std::cout << "Keyword index: " << indexMatches << " matches, " << maskTime / Passes << " microseconds per pass\n";
+	std::cout << "Keyword unindexed: " << unindexedMatches << " matches, " << unindexedTime / Passes << " microseconds per pass\n";
+	if (walkMatches != indexMatches)
+	{
+		std::cerr << "Keyword index disagrees with keyword walk\n";
+		return 1;
+	}
+	if (walkMatches != unindexedMatches)
+	{
+		std::cerr << "Unindexed keyword rows disagree with keyword walk\n";
+		return 1;
+	}
+
+	// a keyword registered after the build leaves every row stale until the next Reset
+	rows.Register(AllKeywords);
+	bool hasAny(false);
+	if (std::any_of(forms.cbegin(), forms.cend(),
+		[&](const SyntheticForm& form) { return rows.DeterminesMatch(&form, masks[0], hasAny); }))
+	{
+		std::cerr << "Stale keyword row used after a later registration\n";
+		return 1;
+	}
+	return 0;
+}
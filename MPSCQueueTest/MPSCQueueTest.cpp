@@ -0,0 +1,120 @@
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "Utilities/BoundedMPSCQueue.h"
+
+// Stress harness for the added-item queue: many producers, one draining consumer, as CollectionManager uses it
+constexpr size_t Producers = 8;
+constexpr size_t ItemsPerProducer = 1000000;
+constexpr size_t Capacity = 4096;
+
+struct Item
+{
+	size_t m_producer;
+	size_t m_sequence;
+};
+
+// With retry every item must arrive. Without retry a full queue drops items, and drained plus dropped must equal
+// pushed. Either way each producer's items arrive once, in the order pushed.
+bool RunStress(const bool retry)
+{
+	shse::BoundedMPSCQueue<Item, Capacity> queue;
+	std::atomic<size_t> running(Producers);
+	std::vector<size_t> failedPushes(Producers, 0);
+	std::vector<std::thread> producers;
+
+	const auto startTime(std::chrono::high_resolution_clock::now());
+	for (size_t producer = 0; producer < Producers; ++producer)
+	{
+		producers.emplace_back([&, producer]() {
+			for (size_t sequence = 0; sequence < ItemsPerProducer; ++sequence)
+			{
+				while (!queue.TryPush(Item({ producer, sequence })))
+				{
+					++failedPushes[producer];
+					if (!retry)
+						break;
+					std::this_thread::yield();
+				}
+			}
+			--running;
+		});
+	}
+
+	std::vector<size_t> nextSequence(Producers, 0);
+	size_t drained(0);
+	size_t overflow(0);
+	bool ok(true);
+	std::vector<Item> batch;
+	for (;;)
+	{
+		// sample before draining, so the final drain sees every completed push
+		const bool finished(running == 0);
+		batch.clear();
+		drained += queue.Drain(batch);
+		overflow += queue.TakeOverflow();
+		for (const Item& item : batch)
+		{
+			if (item.m_producer >= Producers || item.m_sequence < nextSequence[item.m_producer] ||
+				(retry && item.m_sequence != nextSequence[item.m_producer]))
+			{
+				std::cerr << "Producer " << item.m_producer << " item " << item.m_sequence << " out of order, expected "
+					<< nextSequence[item.m_producer] << '\n';
+				ok = false;
+			}
+			nextSequence[item.m_producer] = item.m_sequence + 1;
+		}
+		if (finished)
+			break;
+		if (batch.empty())
+		{
+			std::this_thread::yield();
+		}
+	}
+	for (auto& producer : producers)
+	{
+		producer.join();
+	}
+	const auto elapsed(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - startTime).count());
+
+	size_t failed(0);
+	for (const size_t count : failedPushes)
+	{
+		failed += count;
+	}
+	const size_t pushed(Producers * ItemsPerProducer);
+	std::cout << (retry ? "Retry" : "Drop") << ": " << pushed << " items from " << Producers << " producers, " << drained
+		<< " drained, " << failed << " pushes failed, " << overflow << " overflow reported, " << elapsed << " milliseconds\n";
+	if (overflow != failed)
+	{
+		std::cerr << "Overflow count " << overflow << " does not match failed pushes " << failed << '\n';
+		ok = false;
+	}
+	if (retry ? drained != pushed : drained + failed != pushed)
+	{
+		std::cerr << "Items lost or duplicated\n";
+		ok = false;
+	}
+	if (retry)
+	{
+		for (size_t producer = 0; producer < Producers; ++producer)
+		{
+			if (nextSequence[producer] != ItemsPerProducer)
+			{
+				std::cerr << "Producer " << producer << " stopped at item " << nextSequence[producer] << '\n';
+				ok = false;
+			}
+		}
+	}
+	return ok;
+}
+
+int main(int argc, const char** argv)
+{
+	const bool retryOK(RunStress(true));
+	const bool dropOK(RunStress(false));
+	return retryOK && dropOK ? 0 : 1;
+}
@@ -86,7 +86,7 @@ std::tuple<bool, bool> Collection::InScopeAndCollectibleFor(const ConditionMatch
 		// Collection member always handled if repeats allowed, or as-yet unobserved
 		// If repeats are disallowed, the item is no longer Collectible after first observation
 		// Defer to other rules if repeats are not allowed and this Collection is not dispositive for the item
-		return { m_effectivePolicy.Repeat(), m_observed.contains(matcher.Form()) };
+		return { m_effectivePolicy.Repeat(), HaveObserved(matcher.Form()) };
 	}
 	// absolutely not a member of the collection
 	return { repeat, observed };
@@ -99,15 +99,10 @@ bool Collection::IsActive() const
 	return HasMembers() && (!m_owningGroup->UseMCM() || CollectionManager::Instance().IsMCMEnabled());
 }
 
-bool Collection::HaveObserved(const RE::TESForm* form) const
-{ 
-	return m_observed.contains(form);
-}
-
 bool Collection::RecordItem(const RE::TESForm* form, const float gameTime, const bool suppressSpam)
 {
 	DBG_VMESSAGE("Collect {}/0x{:08x} in {}", form->GetName(), form->GetFormID(), m_name.c_str());
-	if (m_observed.insert({ form, gameTime }).second)
+	if (AddObservation(form, gameTime))
 	{
 		Saga::Instance().AddEvent(ItemCollected(form, this, gameTime));
 		if (m_effectivePolicy.Notify())
@@ -136,7 +131,7 @@ bool Collection::RecordItem(const RE::TESForm* form, const float gameTime, const
 
 void Collection::Reset()
 {
-	m_observed.clear();
+	ClearObservations();
 	m_scopes.clear();
 	InitFromStaticMembers();
 }
@@ -189,35 +184,52 @@ nlohmann::json Collection::MakeJSON() const
 }
 
 void Collection::AsJSON(nlohmann::json& j) const
+{
+	StateAsJSON(j, State());
+}
+
+// caller holds the CollectionManager lock
+CollectionState Collection::State() const
+{
+	return { this, m_effectivePolicy, m_overridesGroup, m_scopes, Observations() };
+}
+
+// the state may have been copied earlier - only the definition is read from this Collection
+void Collection::StateAsJSON(nlohmann::json& j, const CollectionState& state) const
 {
 	j["name"] = m_name;
 	j["description"] = m_description;
-	if (m_overridesGroup)
+	if (state.m_overridesGroup)
 	{
-		j["policy"] = nlohmann::json(m_effectivePolicy);
+		j["policy"] = nlohmann::json(state.m_policy);
 	}
 	m_itemRule->AsJSON(j);
-	if (!m_scopes.empty())
+	if (!state.m_scopes.empty())
 	{
 		nlohmann::json scopes(nlohmann::json::array());
-		for (const auto scope : m_scopes)
+		for (const auto scope : state.m_scopes)
 		{
 			scopes.push_back(int(scope));
 		}
 		j["scopes"] = scopes;
 	}
-	j["members"] = MembersAsJSON();
+	// observed members only - static membership is re-resolved on game load
+	nlohmann::json members(nlohmann::json::array());
+	for (const auto& observation : state.m_observations)
+	{
+		nlohmann::json memberObj(nlohmann::json::object());
+		memberObj["form"] = StringUtils::FromFormID(observation.first);
+		memberObj["time"] = observation.second;
+		members.push_back(memberObj);
+	}
+	j["members"] = members;
 }
 
 // rehydrate collection state from cosave data
 void Collection::UpdateFrom(const nlohmann::json& collectionState, const CollectionPolicy& defaultPolicy)
 {
-	if (collectionState["members"].empty())
-	{
-		// ignore cosave, user can rehydrate from inventory etc
-		REL_WARNING("Collection State {} member list empty in cosave, skipped", m_name);
-		return;
-	}
+	// Member list holds observed members only, static membership is re-resolved from the definitions on game load.
+	// Older cosaves also list unobserved members, and an empty list means nothing collected yet.
 	const std::string name(collectionState["name"].get<std::string>());
 	const std::string description(collectionState["description"].get<std::string>());
 	const auto policy(collectionState.find("policy"));
@@ -264,15 +276,23 @@ void Collection::SetMembersFrom(const nlohmann::json & members)
 void ConditionCollection::InitFromStaticMembers()
 {
 	// if this collection has concrete static members, add them now to seed the list
-	m_members.clear();
-	const auto statics(m_itemRule->StaticMembers());
-	std::copy_if(statics.cbegin(), statics.cend(), std::inserter(m_members, m_members.end()), FormUtils::IsConcrete);
+	// indices are reassigned, so observations must already have been cleared
+	m_memberIndex.clear();
+	m_memberForms.clear();
+	for (const auto form : m_itemRule->StaticMembers())
+	{
+		if (FormUtils::IsConcrete(form))
+		{
+			AddMemberID(form);
+		}
+	}
 }
 
 bool ConditionCollection::AddMemberID(const RE::TESForm* form)const
 {
-	if (form && m_members.insert(form).second)
+	if (form && m_memberIndex.insert({ form, static_cast<uint32_t>(m_memberForms.size()) }).second)
 	{
+		m_memberForms.push_back(form);
 		return true;
 	}
 	return false;
@@ -280,42 +300,71 @@ bool ConditionCollection::AddMemberID(const RE::TESForm* form)const
 
 void ConditionCollection::SetMemberFrom(const nlohmann::json& member, const RE::TESForm* form)
 {
-	m_members.insert(form);
+	AddMemberID(form);
 	const auto observed(member.find("time"));
 	if (observed != member.cend())
 	{
 		// optional, observed member only
 		const float gameTime(observed->get<float>());
-		m_observed.insert({ form, gameTime });
-		Saga::Instance().AddEvent(ItemCollected(form, this, gameTime));
+		if (AddObservation(form, gameTime))
+		{
+			Saga::Instance().AddEvent(ItemCollected(form, this, gameTime));
+		}
 	}
 }
 
-nlohmann::json ConditionCollection::MembersAsJSON() const
+bool ConditionCollection::AddObservation(const RE::TESForm* form, const float gameTime)
 {
-	nlohmann::json members(nlohmann::json::array());
-	for (const auto form : m_members)
+	const auto member(m_memberIndex.find(form));
+	if (member == m_memberIndex.cend() || IsObserved(member->second))
+		return false;
+	const uint32_t index(member->second);
+	if (index >= m_observedTimes.size())
 	{
-		nlohmann::json memberObj(nlohmann::json::object());
-		memberObj["form"] = StringUtils::FromFormID(form->GetFormID());
-		const auto observed(m_observed.find(form));
-		if (observed != m_observed.cend())
-		{
-			// optional, observed member only
-			memberObj["time"] = observed->second;
-		}
-		members.push_back(memberObj);
+		// cover all members resolved so far, so growth is rare after game load
+		m_observedTimes.resize(m_memberForms.size(), 0.0f);
+		m_observedBits.resize((m_memberForms.size() + WordBits - 1) / WordBits, 0);
+	}
+	m_observedBits[index / WordBits] |= uint64_t(1) << (index % WordBits);
+	m_observedTimes[index] = gameTime;
+	++m_observedCount;
+	return true;
+}
+
+void ConditionCollection::ClearObservations()
+{
+	m_observedBits.clear();
+	m_observedTimes.clear();
+	m_observedCount = 0;
+}
+
+bool ConditionCollection::HaveObserved(const RE::TESForm* form) const
+{
+	const auto member(m_memberIndex.find(form));
+	return member != m_memberIndex.cend() && IsObserved(member->second);
+}
+
+std::vector<std::pair<RE::FormID, float>> ConditionCollection::Observations() const
+{
+	std::vector<std::pair<RE::FormID, float>> observations;
+	observations.reserve(m_observedCount);
+	for (uint32_t index = 0; index < m_memberForms.size(); ++index)
+	{
+		if (!IsObserved(index))
+			continue;
+		observations.emplace_back(m_memberForms[index]->GetFormID(), m_observedTimes[index]);
 	}
-	return members;
+	return observations;
 }
 
 std::ostream& ConditionCollection::PrintMemberDetails(std::ostream& os) const
 {
 	// static members with observation status
-	for (const auto member : m_members)
+	for (uint32_t index = 0; index < m_memberForms.size(); ++index)
 	{
+		const auto member(m_memberForms[index]);
 		os << "  0x" << StringUtils::FromFormID(member->GetFormID());
-		os << ", Collected? " << (m_observed.contains(member) ? 'Y' : 'N') << ", (" << member->GetName() << ")\n";
+		os << ", Collected? " << (IsObserved(index) ? 'Y' : 'N') << ", (" << member->GetName() << ")\n";
 	}
 	return os;
 }
@@ -323,7 +372,7 @@ std::ostream& ConditionCollection::PrintMemberDetails(std::ostream& os) const
 bool ConditionCollection::HasMembers() const
 {
 	// Static membership
-	return !m_members.empty();
+	return !m_memberForms.empty();
 }
 
 bool ConditionCollection::IsStaticMatch(const ConditionMatcher& matcher) const
@@ -338,7 +387,7 @@ bool ConditionCollection::IsStaticMatch(const ConditionMatcher& matcher) const
 bool ConditionCollection::IsMemberOf(const ConditionMatcher& matcher) const
 {
 	// Check static list of IDs
-	return matcher.Form() && m_members.contains(matcher.Form());
+	return matcher.Form() && m_memberIndex.contains(matcher.Form());
 }
 
 void CategoryCollection::InitFromStaticMembers()
@@ -353,22 +402,32 @@ void CategoryCollection::SetMemberFrom(const nlohmann::json& member, const RE::T
 	{
 		// optional, observed member only
 		const float gameTime(observed->get<float>());
-		m_observed.insert({ form, gameTime });
-		Saga::Instance().AddEvent(ItemCollected(form, this, gameTime));
+		if (AddObservation(form, gameTime))
+		{
+			Saga::Instance().AddEvent(ItemCollected(form, this, gameTime));
+		}
 	}
 }
 
-nlohmann::json CategoryCollection::MembersAsJSON() const
+bool CategoryCollection::AddObservation(const RE::TESForm* form, const float gameTime)
 {
-	nlohmann::json members(nlohmann::json::array());
+	return m_observed.insert({ form, gameTime }).second;
+}
+
+void CategoryCollection::ClearObservations()
+{
+	m_observed.clear();
+}
+
+std::vector<std::pair<RE::FormID, float>> CategoryCollection::Observations() const
+{
+	std::vector<std::pair<RE::FormID, float>> observations;
+	observations.reserve(m_observed.size());
 	for (const auto observed : m_observed)
 	{
-		nlohmann::json memberObj(nlohmann::json::object());
-		memberObj["form"] = StringUtils::FromFormID(observed.first->GetFormID());
-		memberObj["time"] = observed.second;
-		members.push_back(memberObj);
+		observations.emplace_back(observed.first->GetFormID(), observed.second);
 	}
-	return members;
+	return observations;
 }
 
 std::ostream& CategoryCollection::PrintMemberDetails(std::ostream& os) const
@@ -404,24 +463,16 @@ void to_json(nlohmann::json& j, const Collection& collection)
 	collection.AsJSON(j);
 }
 
-CollectionGroup::CollectionGroup(const std::string& name, const CollectionPolicy& policy, const bool useMCM, const nlohmann::json& collections) :
+CollectionGroup::CollectionGroup(const std::string& name, const CollectionPolicy& policy, const bool useMCM) :
 	m_name(name), m_policy(policy), m_useMCM(useMCM)
 {
-	// input is JSON array, by construction
-	m_collections.reserve(collections.size());
-	std::for_each(collections.cbegin(), collections.cend(), [&] (const nlohmann::json& collection)
-	{
-		try {
-			// Group Policy is the default for Group Member Collection
-			auto newCollection(CollectionFactory::Instance().ParseCollection(this, collection, m_policy));
-			newCollection->Reset();
-			CollectionManager::Instance().RecordCollectibleObjectTypes(newCollection);
-			m_collections.push_back(newCollection);
-		}
-		catch (const std::exception& exc) {
-			REL_ERROR("Error {} parsing Collection\n{}", exc.what(), collection.dump());
-		}
-	});
+}
+
+void CollectionGroup::AddCollection(std::shared_ptr<Collection> collection)
+{
+	collection->Reset();
+	CollectionManager::Instance().RecordCollectibleObjectTypes(collection);
+	m_collections.push_back(collection);
 }
 
 std::shared_ptr<Collection> CollectionGroup::CollectionByName(const std::string& collectionName) const
@@ -445,14 +496,33 @@ void CollectionGroup::SyncDefaultPolicy()
 }
 
 void CollectionGroup::AsJSON(nlohmann::json& j) const
+{
+	StateAsJSON(j, m_policy, CollectionStates());
+}
+
+// caller holds the CollectionManager lock
+std::vector<CollectionState> CollectionGroup::CollectionStates() const
+{
+	std::vector<CollectionState> collections;
+	collections.reserve(m_collections.size());
+	for (const auto& collection : m_collections)
+	{
+		collections.push_back(collection->State());
+	}
+	return collections;
+}
+
+void CollectionGroup::StateAsJSON(nlohmann::json& j, const CollectionPolicy& policy, const std::vector<CollectionState>& collections) const
 {
 	j["name"] = m_name;
-	j["groupPolicy"] = nlohmann::json(m_policy);
+	j["groupPolicy"] = nlohmann::json(policy);
 	j["useMCM"] = m_useMCM;
 	j["collectionState"] = nlohmann::json::array();
-	for (const auto& collection : m_collections)
+	for (const auto& collection : collections)
 	{
-		j["collectionState"].push_back(*collection);
+		nlohmann::json collectionState;
+		collection.m_collection->StateAsJSON(collectionState, collection);
+		j["collectionState"].push_back(collectionState);
 	}
 }
 
@@ -69,12 +69,26 @@ private:
 	const float m_gameTime;
 };
 
+// Cosave state of a Collection that can change after load, copied under the CollectionManager lock. The definition
+// is fixed once loaded, so its JSON is built from the Collection itself after the lock is released.
+struct CollectionState {
+	const Collection* m_collection;
+	CollectionPolicy m_policy;
+	bool m_overridesGroup;
+	std::vector<INIFile::SecondaryType> m_scopes;
+	// observed members with the game time each was collected
+	std::vector<std::pair<RE::FormID, float>> m_observations;
+};
+
 class Collection {
 protected:
 	virtual void InitFromStaticMembers() = 0;
 	virtual void SetMemberFrom(const nlohmann::json& member, const RE::TESForm* form) = 0;
-	virtual nlohmann::json MembersAsJSON() const = 0;
+	virtual std::vector<std::pair<RE::FormID, float>> Observations() const = 0;
 	virtual std::ostream& PrintMemberDetails(std::ostream& os) const = 0;
+	// observation storage is specific to the type of Collection
+	virtual bool AddObservation(const RE::TESForm* form, const float gameTime) = 0;
+	virtual void ClearObservations() = 0;
 
 	// inputs
 	std::string m_name;
@@ -84,7 +98,6 @@ protected:
 	bool m_overridesGroup;
 	std::unique_ptr<ItemRule> m_itemRule;
 	// derived
-	std::unordered_map<const RE::TESForm*, float> m_observed;
 	std::vector<INIFile::SecondaryType> m_scopes;
 	const CollectionGroup* m_owningGroup;
 
@@ -104,14 +117,16 @@ public:
 	inline bool OverridesGroup() const { return m_overridesGroup; }
 	inline void SetOverridesGroup(const bool overridesGroup) { m_overridesGroup = overridesGroup; }
 	virtual size_t Count() const = 0;
-	inline size_t Observed() const { return m_observed.size(); }
+	virtual size_t Observed() const = 0;
 	virtual std::string GetStatusMessage() const = 0;
-	bool HaveObserved(const RE::TESForm* form) const;
+	virtual bool HaveObserved(const RE::TESForm* form) const = 0;
 	bool RecordItem(const RE::TESForm* form, const float gameTime, const bool suppressSpam);
 	void Reset();
 
 	nlohmann::json MakeJSON() const;
 	void AsJSON(nlohmann::json& j) const;
+	CollectionState State() const;
+	void StateAsJSON(nlohmann::json& j, const CollectionState& state) const;
 	void UpdateFrom(const nlohmann::json& collectionState, const CollectionPolicy& defaultPolicy);
 	void SetScopesFrom(const nlohmann::json& scopes);
 	void SetMembersFrom(const nlohmann::json& members);
@@ -121,7 +136,8 @@ public:
 	std::string PrintDefinition(void) const;
 	std::string PrintMembers(void) const;
 	inline void SetScopes(const std::vector<INIFile::SecondaryType>& scopes) { m_scopes = scopes; }
-	virtual std::unordered_set<const RE::TESForm*> Members() const = 0;
+	// view is invalidated if membership changes
+	virtual FormView Members() const = 0;
 };
 
 class ConditionCollection : public Collection {
@@ -130,18 +146,35 @@ public:
 	virtual bool HasMembers() const override;
 	virtual bool IsStaticMatch(const ConditionMatcher& matcher) const override;
 	virtual inline std::vector<ObjectType> ObjectTypes(void) const override { return std::vector<ObjectType>(); }
-	virtual inline size_t Count() const override { return m_members.size(); }
+	virtual inline size_t Count() const override { return m_memberForms.size(); }
+	virtual inline size_t Observed() const override { return m_observedCount; }
 	virtual inline std::string GetStatusMessage() const override { return "$SHSE_CONDITION_COLLECTION_PROGRESS"; }
-	virtual inline std::unordered_set<const RE::TESForm*> Members() const override { return m_members; }
+	virtual bool HaveObserved(const RE::TESForm* form) const override;
+	virtual inline FormView Members() const override { return m_memberForms; }
 protected:
 	virtual void InitFromStaticMembers() override;
 	bool AddMemberID(const RE::TESForm* form) const;
 	virtual void SetMemberFrom(const nlohmann::json& member, const RE::TESForm* form) override;
-	virtual nlohmann::json MembersAsJSON() const override;
+	virtual std::vector<std::pair<RE::FormID, float>> Observations() const override;
 	virtual std::ostream& PrintMemberDetails(std::ostream& os) const override;
 	virtual bool IsMemberOf(const ConditionMatcher& matcher) const override;
+	virtual bool AddObservation(const RE::TESForm* form, const float gameTime) override;
+	virtual void ClearObservations() override;
 private:
-	mutable std::unordered_set<const RE::TESForm*> m_members;
+	static constexpr size_t WordBits = 64;
+	inline bool IsObserved(const uint32_t index) const
+	{
+		const size_t word(index / WordBits);
+		return word < m_observedBits.size() && (m_observedBits[word] & (uint64_t(1) << (index % WordBits))) != 0;
+	}
+
+	// Members get dense indices in order of resolution. Membership grows during const static matching, hence mutable.
+	mutable std::unordered_map<const RE::TESForm*, uint32_t> m_memberIndex;
+	mutable std::vector<const RE::TESForm*> m_memberForms;
+	// observations by member index: bitset plus packed game time, sized on first observation past the current end
+	std::vector<uint64_t> m_observedBits;
+	std::vector<float> m_observedTimes;
+	size_t m_observedCount = 0;
 };
 
 class CategoryCollection : public Collection {
@@ -151,27 +184,37 @@ public:
 	virtual bool IsStaticMatch(const ConditionMatcher&) const override;
 	virtual inline std::vector<ObjectType> ObjectTypes(void) const override { return m_itemRule->GetObjectTypes(); }
 	inline size_t Count() const { return Observed(); }
+	virtual inline size_t Observed() const override { return m_observed.size(); }
 	virtual inline std::string GetStatusMessage() const override { return "$SHSE_CATEGORY_COLLECTION_PROGRESS"; }
-	virtual inline std::unordered_set<const RE::TESForm*> Members() const override { return std::unordered_set<const RE::TESForm*>(); }
+	virtual inline bool HaveObserved(const RE::TESForm* form) const override { return m_observed.contains(form); }
+	virtual inline FormView Members() const override { return FormView(); }
 protected:
 	virtual void InitFromStaticMembers() override;
 	virtual void SetMemberFrom(const nlohmann::json& member, const RE::TESForm* form) override;
-	virtual nlohmann::json MembersAsJSON() const override;
+	virtual std::vector<std::pair<RE::FormID, float>> Observations() const override;
 	virtual std::ostream& PrintMemberDetails(std::ostream& os) const override;
 	virtual bool IsMemberOf(const ConditionMatcher& matcher) const override;
+	virtual bool AddObservation(const RE::TESForm* form, const float gameTime) override;
+	virtual void ClearObservations() override;
+private:
+	// membership is not static, observations are keyed by Form
+	std::unordered_map<const RE::TESForm*, float> m_observed;
 };
 
 void to_json(nlohmann::json& j, const Collection& collection);
 
 class CollectionGroup {
 public:
-	CollectionGroup(const std::string& name, const CollectionPolicy& policy, const bool useMCM, const nlohmann::json& collections);
+	CollectionGroup(const std::string& name, const CollectionPolicy& policy, const bool useMCM);
+	void AddCollection(std::shared_ptr<Collection> collection);
 	inline const std::vector<std::shared_ptr<Collection>>& Collections() const { return m_collections; }
 	std::shared_ptr<Collection> CollectionByName(const std::string& collectionName) const;
 	inline std::string Name() const { return m_name; }
 	inline bool UseMCM() const { return m_useMCM; }
 
 	void AsJSON(nlohmann::json& j) const;
+	std::vector<CollectionState> CollectionStates() const;
+	void StateAsJSON(nlohmann::json& j, const CollectionPolicy& policy, const std::vector<CollectionState>& collections) const;
 	void UpdateFrom(const nlohmann::json& group);
 
 	inline const CollectionPolicy& Policy() const { return m_policy; }
@@ -37,159 +37,76 @@ CollectionFactory& CollectionFactory::Instance()
 	return *m_instance;
 }
 
-std::unique_ptr<PluginCondition> CollectionFactory::ParsePlugin(const nlohmann::json& pluginRule) const
-{
-	std::vector<std::string> plugins;
-	plugins.reserve(pluginRule.size());
-	std::transform(pluginRule.cbegin(), pluginRule.cend(), std::back_inserter(plugins),
-		[&](const nlohmann::json& next) { return next.get<std::string>(); });
-	return std::make_unique<PluginCondition>(plugins);
-}
-
-std::unique_ptr<FormListCondition> CollectionFactory::ParseFormList(const nlohmann::json& formListRule) const
-{
-	std::vector<std::pair<std::string, std::string>> pluginFormLists;
-	pluginFormLists.reserve(formListRule.size());
-	std::transform(formListRule.cbegin(), formListRule.cend(), std::back_inserter(pluginFormLists),
-		[&](const nlohmann::json& next) { return std::make_pair(next["listPlugin"], next["formID"]); });
-	return std::make_unique<FormListCondition>(pluginFormLists);
-}
-
-std::unique_ptr<FormsCondition> CollectionFactory::ParseForms(const nlohmann::json& formsRule) const
-{
-	return std::make_unique<FormsCondition>(JSONUtils::ParseFormsType(formsRule));
-}
-
-std::unique_ptr<KeywordCondition> CollectionFactory::ParseKeyword(const nlohmann::json& keywordRule) const
-{
-	std::vector<std::string> keywords;
-	keywords.reserve(keywordRule.size());
-	std::transform(keywordRule.cbegin(), keywordRule.cend(), std::back_inserter(keywords),
-		[&](const nlohmann::json& next) { return next.get<std::string>(); });
-	return std::make_unique<KeywordCondition>(keywords);
-}
-
-std::unique_ptr<SignatureCondition> CollectionFactory::ParseSignature(const nlohmann::json& signatureRule) const
-{
-	std::vector<std::string> signatures;
-	signatures.reserve(signatureRule.size());
-	std::transform(signatureRule.cbegin(), signatureRule.cend(), std::back_inserter(signatures),
-		[&](const nlohmann::json& next) { return next.get<std::string>(); });
-	return std::make_unique<SignatureCondition>(signatures);
-}
-
-std::unique_ptr<ScopeCondition> CollectionFactory::ParseScope(const nlohmann::json& scopeRule) const
+CollectionPolicy CollectionFactory::ParsePolicy(const nlohmann::json& policy) const
 {
-	std::vector<std::string> scopes;
-	scopes.reserve(scopeRule.size());
-	std::transform(scopeRule.cbegin(), scopeRule.cend(), std::back_inserter(scopes),
-		[&](const nlohmann::json& next) { return next.get<std::string>(); });
-	return std::make_unique<ScopeCondition>(scopes);
+	return CollectionPolicy(ParseCollectibleHandling(policy["action"].get<std::string>()),
+		policy["notify"].get<bool>(), policy["repeat"].get<bool>());
 }
 
-std::unique_ptr<NameMatchCondition> CollectionFactory::ParseNameMatch(const nlohmann::json& nameMatchRule) const
+CollectionPolicy CollectionFactory::MakePolicy(const PolicyDefinition& policy) const
 {
-	std::vector<std::string> names;
-	names.reserve(nameMatchRule["names"].size());
-	std::transform(std::cbegin(nameMatchRule["names"]), std::cend(nameMatchRule["names"]), std::back_inserter(names),
-		[&](const nlohmann::json& next) { return next.get<std::string>(); });
-	return std::make_unique<NameMatchCondition>(nameMatchRule["isNPC"].get<bool>(), nameMatchRule["matchIf"].get<std::string>(), names);
+	return CollectionPolicy(ParseCollectibleHandling(policy.m_action), policy.m_notify, policy.m_repeat);
 }
 
-CollectionPolicy CollectionFactory::ParsePolicy(const nlohmann::json& policy) const
+// Conditions are added in key order, as the DOM walk found them in nlohmann objects. Evaluation short-circuits and
+// ScopeCondition aggregates scope as a side-effect, so the order is fixed whatever the order in the file.
+std::unique_ptr<FilterTree> CollectionFactory::BuildFilter(const FilterDefinition& filter, const unsigned int depth) const
 {
-	return CollectionPolicy(ParseCollectibleHandling(policy["action"].get<std::string>()),
-		policy["notify"].get<bool>(), policy["repeat"].get<bool>());
+	std::unique_ptr<FilterTree> tree(std::make_unique<FilterTree>(
+		filter.m_isAnd ? FilterTree::Operator::And : FilterTree::Operator::Or, depth));
+	if (!filter.m_formLists.empty())
+		tree->AddCondition(std::make_unique<FormListCondition>(filter.m_formLists));
+	if (!filter.m_forms.empty())
+		tree->AddCondition(std::make_unique<FormsCondition>(filter.m_forms));
+	if (!filter.m_keywords.empty())
+		tree->AddCondition(std::make_unique<KeywordCondition>(filter.m_keywords));
+	if (filter.m_nameMatch)
+		tree->AddCondition(std::make_unique<NameMatchCondition>(
+			filter.m_nameMatch->m_isNPC, filter.m_nameMatch->m_matchIf, filter.m_nameMatch->m_names));
+	if (!filter.m_plugins.empty())
+		tree->AddCondition(std::make_unique<PluginCondition>(filter.m_plugins));
+	if (!filter.m_scopes.empty())
+		tree->AddCondition(std::make_unique<ScopeCondition>(filter.m_scopes));
+	if (!filter.m_signatures.empty())
+		tree->AddCondition(std::make_unique<SignatureCondition>(filter.m_signatures));
+	for (const auto& subFilter : filter.m_subFilters)
+	{
+		tree->AddCondition(BuildFilter(subFilter, depth + 1));
+	}
+	return tree;
 }
 
-std::unique_ptr<FilterTree> CollectionFactory::ParseFilter(const nlohmann::json& filter, const unsigned int depth) const
+std::shared_ptr<CollectionGroup> CollectionFactory::BuildGroup(
+	const CollectionGroupDefinition& definition, const std::string& groupName) const
 {
-	FilterTree::Operator op;
-	if (filter["operator"].get<std::string>() == "AND")
-	{
-		op = FilterTree::Operator::And;
-	}
-	else
+	std::shared_ptr<CollectionGroup> group(std::make_shared<CollectionGroup>(groupName, MakePolicy(definition.m_groupPolicy), definition.m_useMCM));
+	for (const auto& collection : definition.m_collections)
 	{
-		op = FilterTree::Operator::Or;
-	}
-	std::unique_ptr<FilterTree> root(std::make_unique<FilterTree>(op, depth));
-	for (const auto& condition : filter["condition"].items())
-	{
-		if (condition.key() == "subFilter")
-		{
-			for (const auto& subFilter : condition.value())
+		// an unresolvable Condition drops the Collection, but not the rest of the Group
+		try {
+			DBG_VMESSAGE("Collection {}, overrides Policy = {}", collection.m_name.c_str(), collection.m_policy ? "true" : "false");
+			// Group Policy is the default for Group Member Collection
+			const CollectionPolicy policy(collection.m_policy ? MakePolicy(*collection.m_policy) : group->Policy());
+			std::shared_ptr<Collection> newCollection;
+			if (collection.m_rootFilter)
 			{
-				root->AddCondition(ParseFilter(subFilter, depth + 1));
+				newCollection = std::make_shared<ConditionCollection>(group.get(), collection.m_name, collection.m_description,
+					policy, collection.m_policy.has_value(), BuildFilter(*collection.m_rootFilter, 0));
 			}
+			else
+			{
+				std::unique_ptr<CategoryRule> rule(std::make_unique<CategoryRule>());
+				rule->SetCondition(std::make_unique<CategoryCondition>(collection.m_categories));
+				newCollection = std::make_shared<CategoryCollection>(group.get(), collection.m_name, collection.m_description,
+					policy, collection.m_policy.has_value(), std::move(rule));
+			}
+			group->AddCollection(newCollection);
 		}
-		else if (condition.key() == "plugin")
-		{
-			root->AddCondition(ParsePlugin(condition.value()));
-		}
-		else if (condition.key() == "formList")
-		{
-			root->AddCondition(ParseFormList(condition.value()));
-		}
-		else if (condition.key() == "forms")
-		{
-			root->AddCondition(ParseForms(condition.value()));
-		}
-		else if (condition.key() == "keyword")
-		{
-			root->AddCondition(ParseKeyword(condition.value()));
-		}
-		else if (condition.key() == std::string("signature"))
-		{
-			root->AddCondition(ParseSignature(condition.value()));
-		}
-		else if (condition.key() == std::string("scope"))
-		{
-			root->AddCondition(ParseScope(condition.value()));
-		}
-		else if (condition.key() == std::string("nameMatch"))
-		{
-			root->AddCondition(ParseNameMatch(condition.value()));
+		catch (const std::exception& exc) {
+			REL_ERROR("Error {} parsing Collection {}", exc.what(), collection.m_name);
 		}
 	}
-
-	return root;
-}
-
-std::unique_ptr<CategoryRule> CollectionFactory::ParseCategory(const nlohmann::json& categoryRule) const
-{
-	std::unique_ptr<CategoryRule> rule(std::make_unique<CategoryRule>());
-	std::vector<std::string> categories;
-	categories.reserve(categoryRule.size());
-	std::transform(categoryRule.cbegin(), categoryRule.cend(), std::back_inserter(categories),
-		[&](const nlohmann::json& next) { return next.get<std::string>(); });
-	rule->SetCondition(std::make_unique<CategoryCondition>(categories));
-	return rule;
-}
-
-std::shared_ptr<Collection> CollectionFactory::ParseCollection(
-	const CollectionGroup* owningGroup, const nlohmann::json& collection, const CollectionPolicy& defaultPolicy) const
-{
-	const auto policy(collection.find("policy"));
-	const std::string name(collection["name"].get<std::string>());
-	bool overridesPolicy(policy != collection.cend());
-	DBG_VMESSAGE("Collection {}, overrides Policy = {}", name.c_str(), overridesPolicy ? "true" : "false");
-	if (collection.find("rootFilter") != collection.cend())
-	{
-		return std::make_shared<ConditionCollection>(owningGroup, name, collection["description"].get<std::string>(),
-			policy != collection.cend() ? ParsePolicy(collection["policy"]) : defaultPolicy, overridesPolicy, ParseFilter(collection["rootFilter"], 0));
-	}
-	else if (collection.find("category") != collection.cend())
-	{
-		return std::make_shared<CategoryCollection>(owningGroup, name, collection["description"].get<std::string>(),
-			policy != collection.cend() ? ParsePolicy(collection["policy"]) : defaultPolicy, overridesPolicy, ParseCategory(collection["category"]));
-	}
-	return std::shared_ptr<Collection>();
-}
-
-std::shared_ptr<CollectionGroup> CollectionFactory::ParseGroup(const nlohmann::json& group, const std::string& groupName) const
-{
-	return std::make_shared<CollectionGroup>(groupName, ParsePolicy(group["groupPolicy"]), group["useMCM"].get<bool>(), group["collections"]);
+	return group;
 }
 
 }
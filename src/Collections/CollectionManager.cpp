@@ -25,6 +25,7 @@ http://www.fsf.org/licensing/licenses
 #include "Utilities/LogStackWalker.h"
 #include "Utilities/Exception.h"
 #include "Utilities/utils.h"
+#include "WorldState/InventoryTracker.h"
 #include "WorldState/LocationTracker.h"
 #include "VM/EventPublisher.h"
 #include "VM/papyrus.h"
@@ -32,6 +33,7 @@ http://www.fsf.org/licensing/licenses
 #include "Collections/CollectionFactory.h"
 #include "Data/CosaveData.h"
 #include "Data/DataCase.h"
+#include "Data/KeywordIndex.h"
 #include "Data/SettingsCache.h"
 #include "Data/LoadOrder.h"
 #include "Looting/ManagedLists.h"
@@ -65,6 +67,8 @@ void CollectionManager::ProcessDefinitions(void)
 	__try {
 		if (!LoadData())
 			return;
+		// KeywordConditions registered their KYWDs during load
+		KeywordIndex::Instance().IndexForms();
 
 		// data validated and loaded
 		m_ready = true;
@@ -97,7 +101,6 @@ void CollectionManager::CollectFromContainer(const RE::TESObjectREFR* refr)
 	ContainerLister lister(INIFile::SecondaryType::deadbodies, refr);
 	// filter to include only collectibles
 	lister.FilterLootableItems([=](RE::TESBoundObject* item) -> bool { return ItemIsCollectionCandidate(item); });
-	decltype(m_lastInventoryCollectibles) newInventoryCollectibles;
 	for (const auto& candidate : lister.GetLootableItems())
 	{
 		// assume loose item, we don't know the original source
@@ -114,19 +117,22 @@ void CollectionManager::CollectFromContainer(const RE::TESObjectREFR* refr)
 
 void CollectionManager::CheckEnqueueAddedItem(RE::TESBoundObject* form, const INIFile::SecondaryType scope, const ObjectType objectType)
 {
-	if (!IsAvailable())
+	// no lock - membership in >= 1 collection is checked again when the queue is drained
+	if (!IsAvailable() || !form)
 		return;
-	RecursiveLockGuard guard(m_collectionLock);
-	// only pass this along if it is in >= 1 collection
-	if (ItemIsCollectionCandidate(form))
-	{
-		EnqueueAddedItem(form, scope, objectType);
-	}
+	const std::shared_ptr<const CandidateSet> candidates(m_candidates.load(std::memory_order_acquire));
+	if (candidates && !candidates->m_formIDs.contains(form->GetFormID()) &&
+		!candidates->m_objectTypes.contains(GetEffectiveObjectType(form)))
+		return;
+	EnqueueAddedItem(form, scope, objectType);
 }
 
 void CollectionManager::EnqueueAddedItem(RE::TESBoundObject* form, const INIFile::SecondaryType scope, const ObjectType objectType)
 {
-	m_addedItemQueue.emplace_back(std::make_tuple(form, scope, objectType));
+	if (!m_addedItemQueue.TryPush(std::make_tuple(form, scope, objectType)))
+	{
+		DBG_WARNING("Added item queue full, drop {}/0x{:08x}", form->GetName(), form->GetFormID());
+	}
 }
 
 void CollectionManager::ProcessAddedItems()
@@ -141,7 +147,13 @@ void CollectionManager::ProcessAddedItems()
 	constexpr std::chrono::milliseconds InventoryReconciliationIntervalMillis(5000LL);
 	const auto nowTime(std::chrono::high_resolution_clock::now());
 	std::vector<OwnedItem> queuedItems;
-	queuedItems.swap(m_addedItemQueue);
+	m_addedItemQueue.Drain(queuedItems);
+	const size_t overflow(m_addedItemQueue.TakeOverflow());
+	if (overflow > 0)
+	{
+		// items that reached player inventory are picked up by reconciliation
+		REL_WARNING("Added item queue overflowed, {} items dropped", overflow);
+	}
 	if (nowTime - m_lastInventoryCheck >= InventoryReconciliationIntervalMillis)
 	{
 		DBG_MESSAGE("Inventory reconciliation required");
@@ -199,6 +211,11 @@ void CollectionManager::AddToRelevantCollections(const ConditionMatcher& matcher
 			(nextCollection->Policy().Repeat() || !nextCollection->HaveObserved(matcher.Form())) &&
 			nextCollection->IsMemberOf(matcher))
 		{
+			// first observation in a no-repeat Collection changes the decision for this Form
+			if (!nextCollection->Policy().Repeat())
+			{
+				m_collectibleDecisions.erase(matcher.Form()->GetFormID());
+			}
 			// record membership - suppress notifications if there are too many
 			if (nextCollection->RecordItem(matcher.Form(), gameTime, m_notifications >= CollectedSpamLimit))
 			{
@@ -219,6 +236,7 @@ void CollectionManager::AddToRelevantCollections(const ConditionMatcher& matcher
 	}
 	if (atLeastOne)
 	{
+		++m_generation;
 		// Ensure Location of Item Collection is recorded
 		LocationTracker::Instance().RecordCurrentPlace(gameTime);
 	}
@@ -229,13 +247,40 @@ std::pair<bool, CollectibleHandling> CollectionManager::TreatAsCollectible(const
 	if (!IsAvailable() || !matcher.Form())
 		return NotCollectible;
 	RecursiveLockGuard guard(m_collectionLock);
+	const RE::FormID formID(matcher.Form()->GetFormID());
+	const bool collectedOnThisScan(m_collectedOnThisScan.contains(formID));
+	std::vector<CollectibleDecision>& decisions(m_collectibleDecisions[formID]);
+	const auto cached(std::find_if(decisions.cbegin(), decisions.cend(), [&](const CollectibleDecision& decision) -> bool {
+		return decision.m_scope == matcher.Scope() && decision.m_objectType == matcher.GetObjectType() &&
+			decision.m_collectedOnThisScan == collectedOnThisScan;
+	}));
+	std::pair<bool, CollectibleHandling> outcome;
+	if (cached != decisions.cend())
+	{
+		outcome = cached->m_outcome;
+	}
+	else
+	{
+		outcome = EvaluateCollectible(matcher, collectedOnThisScan);
+		decisions.push_back({ matcher.Scope(), matcher.GetObjectType(), collectedOnThisScan, outcome });
+	}
+	// prevent dups - if this is an item Collectibility precheck don't trigger this logic, or we won't actually loot the item
+	if (recordDups && outcome.first)
+	{
+		m_collectedOnThisScan.insert(formID);
+	}
+	return outcome;
+}
+
+std::pair<bool, CollectibleHandling> CollectionManager::EvaluateCollectible(
+	const ConditionMatcher& matcher, const bool collectedOnThisScan) const
+{
 	// Filter for Static and Dynamic Collections that match this Form
 	// Find the most aggressive action for any where we are in scope and a usable member.
 	CollectibleHandling action(CollectibleHandling::Leave);
 	bool actionable(false);
 	bool defer(false);
-	RE::FormID formID(matcher.Form()->GetFormID());
-	const auto staticTargets(m_collectionsByFormID.equal_range(formID));
+	const auto staticTargets(m_collectionsByFormID.equal_range(matcher.Form()->GetFormID()));
 	auto checkCollection = [&](decltype(staticTargets.first->second) nextCollection) {
 		// skip disabled collections
 		if (!nextCollection->IsActive())
@@ -243,9 +288,9 @@ std::pair<bool, CollectibleHandling> CollectionManager::TreatAsCollectible(const
 		bool repeat;
 		bool observed;
 		std::tie(repeat, observed) = nextCollection->InScopeAndCollectibleFor(matcher);
-		// If we already saw this item on this scan, this is a repeat observation. m_observed is not updated
+		// If we already saw this item on this scan, this is a repeat observation. Collection observations are not updated
 		// until Collection add, which happens later on after item is in inventory.
-		observed = observed || m_collectedOnThisScan.contains(formID);
+		observed = observed || collectedOnThisScan;
 		if (repeat || !observed)
 		{
 			// The Collection definitively treats this observation of the item as a member
@@ -275,56 +320,140 @@ std::pair<bool, CollectibleHandling> CollectionManager::TreatAsCollectible(const
 	{
 		return NotCollectible;
 	}
-	// prevent dups - if this is an item Collectibility precheck don't trigger this logic, or we won't actually loot the item
-	if (recordDups && actionable)
-	{
-		m_collectedOnThisScan.insert(formID);
-	}
 	return std::make_pair(actionable, action);
 }
 
-// Player inventory can get objects from Loot menus and other sources than our harvesting, we need to account for them
-// We don't do this on every pass as it's a decent amount of work. Filter on Collectible item trait to reduce work.
+void CollectionManager::InvalidateCollectibleDecisions()
+{
+	DBG_MESSAGE("Invalidate {} memoized Collectible decisions", m_collectibleDecisions.size());
+	m_collectibleDecisions.clear();
+}
+
+// Player inventory can get objects from Loot menus and other sources than our harvesting, we need to account for them.
+// Only items whose count changed per container-changed events since the last pass are checked. An item is new if
+// it was absent from the snapshot before this pass. Filter on Collectible item trait to reduce work.
 void CollectionManager::ReconcileInventory(std::vector<OwnedItem>& additions)
+{
+	// full rescan is a rare safety net for changes not seen as events, and establishes the snapshot after game reload
+	constexpr std::chrono::milliseconds InventoryRescanIntervalMillis(300000LL);
+	const auto nowTime(std::chrono::high_resolution_clock::now());
+	if (m_lastInventoryRescan == decltype(m_lastInventoryRescan)() ||
+		nowTime - m_lastInventoryRescan >= InventoryRescanIntervalMillis)
+	{
+		m_lastInventoryRescan = nowTime;
+		// the walk counts every change seen so far. Events arriving during or after the walk stay queued for the next
+		// pass, so none is lost between the walk and the discard.
+		InventoryTracker::Instance().TakeDeltas();
+		RescanInventory(additions);
+		return;
+	}
+
+	const InventoryTracker::CountDeltas deltas(InventoryTracker::Instance().TakeDeltas());
+
+	for (const auto& delta : deltas)
+	{
+		if (delta.second == 0)
+			continue;
+		RE::TESBoundObject* item(RE::TESForm::LookupByID<RE::TESBoundObject>(delta.first));
+		if (!item || !ItemIsCollectionCandidate(item))
+			continue;
+		int32_t& count(m_inventoryCollectibleCounts[delta.first]);
+		const bool wasHeld(count > 0);
+		count += delta.second;
+		if (count <= 0)
+		{
+			DBG_VMESSAGE("Collectible {}/0x{:08x} no longer in inventory", item->GetName(), item->GetFormID());
+			m_inventoryCollectibleCounts.erase(delta.first);
+		}
+		else if (!wasHeld)
+		{
+			DBG_VMESSAGE("Collectible {}/0x{:08x} new in inventory", item->GetName(), item->GetFormID());
+			// Assumes loose item since we apparently did not autoloot it
+			additions.emplace_back(std::make_tuple(item, INIFile::SecondaryType::itemObjects, GetEffectiveObjectType(item)));
+		}
+		else
+		{
+			DBG_VMESSAGE("Skip {}/0x{:08x} already in inventory, count now {}", item->GetName(), item->GetFormID(), count);
+		}
+	}
+}
+
+void CollectionManager::RescanInventory(std::vector<OwnedItem>& additions)
 {
 	RE::PlayerCharacter* player(RE::PlayerCharacter::GetSingleton());
 	if (!player)
 		return;
 
-	// use delta vs last pass to speed this up (resets on game reload)
+	const auto startTime(std::chrono::high_resolution_clock::now());
 	ContainerLister lister(INIFile::SecondaryType::deadbodies, player);
 	// filter to include only collectibles
 	lister.FilterLootableItems([=](RE::TESBoundObject* item) -> bool { return ItemIsCollectionCandidate(item); });
-	decltype(m_lastInventoryCollectibles) newInventoryCollectibles;
+	decltype(m_inventoryCollectibleCounts) newCounts;
 	for (const auto& candidate : lister.GetLootableItems())
 	{
-		const auto item(candidate.BoundObject());
-		newInventoryCollectibles.insert(item);
-		if (!m_lastInventoryCollectibles.contains(item))
+		newCounts[candidate.BoundObject()->GetFormID()] += static_cast<int32_t>(candidate.Count());
+	}
+	// diff vs tracked counts - after game reload everything is an addition, otherwise this is what events missed
+	size_t added(0);
+	size_t changed(0);
+	for (const auto& current : newCounts)
+	{
+		const auto previous(m_inventoryCollectibleCounts.find(current.first));
+		if (previous == m_inventoryCollectibleCounts.cend())
 		{
+			RE::TESBoundObject* item(RE::TESForm::LookupByID<RE::TESBoundObject>(current.first));
 			DBG_VMESSAGE("Collectible {}/0x{:08x} new in inventory", item->GetName(), item->GetFormID());
 			// Assumes loose item since we apparently did not autoloot it
 			additions.emplace_back(std::make_tuple(item, INIFile::SecondaryType::itemObjects, GetEffectiveObjectType(item)));
+			++added;
 		}
-		else
+		else if (previous->second != current.second)
 		{
-			DBG_VMESSAGE("Skip {}/0x{:08x} unchanged in inventory", item->GetName(), item->GetFormID());
+			++changed;
 		}
 	}
-	m_lastInventoryCollectibles.swap(newInventoryCollectibles);
+	size_t removed(0);
+	for (const auto& tracked : m_inventoryCollectibleCounts)
+	{
+		if (!newCounts.contains(tracked.first))
+			++removed;
+	}
+	m_inventoryCollectibleCounts.swap(newCounts);
+	const auto elapsed(std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::high_resolution_clock::now() - startTime).count());
+	REL_MESSAGE("Rescanned Player inventory in {} microseconds: {} collectibles, untracked {} added/{} changed/{} removed",
+		elapsed, m_inventoryCollectibleCounts.size(), added, changed, removed);
 }
 
-bool CollectionManager::LoadCollectionGroup(
-	const std::filesystem::path& defFile, const std::string& groupName, nlohmann::json_schema::json_validator& validator)
+// Runs on a worker thread per file. Reading and schema checks touch no game data.
+CollectionFileDefinition CollectionManager::ReadCollectionFile(const std::filesystem::path& defFile)
+{
+	const auto startTime(std::chrono::high_resolution_clock::now());
+	std::ifstream collectionFile(defFile, std::ios::binary);
+	if (collectionFile.fail()) {
+		throw FileNotFound(defFile.generic_wstring().c_str());
+	}
+	const std::string text((std::istreambuf_iterator<char>(collectionFile)), std::istreambuf_iterator<char>());
+	CollectionGroupDefinition definition(ReadCollectionGroupDefinition(text));
+	return { std::move(definition), text.size(), std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::high_resolution_clock::now() - startTime).count() };
+}
+
+bool CollectionManager::LoadCollectionGroup(const std::filesystem::path& defFile, const std::string& groupName,
+	std::future<CollectionFileDefinition>& fileDefinition)
 {
 	try {
-		std::ifstream collectionFile(defFile);
-		if (collectionFile.fail()) {
-			throw FileNotFound(defFile.generic_wstring().c_str());
-		}
-		nlohmann::json collectionGroupData(nlohmann::json::parse(collectionFile));
-		validator.validate(collectionGroupData);
-		const auto collectionGroup(CollectionFactory::Instance().ParseGroup(collectionGroupData, groupName));
+		// rethrows any error from reading the file or checking its schema
+		CollectionGroupDefinition definition;
+		size_t fileSize(0);
+		long long readMicros(0);
+		std::tie(definition, fileSize, readMicros) = fileDefinition.get();
+		// Building resolves Forms and registers Keywords, not thread-safe
+		const auto startTime(std::chrono::high_resolution_clock::now());
+		const auto collectionGroup(CollectionFactory::Instance().BuildGroup(definition, groupName));
+		REL_MESSAGE("JSON Collection Definitions {} ({} bytes) read and parsed in {} microseconds, built in {} microseconds",
+			StringUtils::FromUnicode(defFile.filename().generic_wstring()), fileSize, readMicros,
+			std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - startTime).count());
 		BuildDecisionTrees(collectionGroup);
 		if (collectionGroup->UseMCM())
 		{
@@ -341,27 +470,10 @@ bool CollectionManager::LoadCollectionGroup(
 
 bool CollectionManager::LoadData(void)
 {
-	// Validate the schema
-	const std::string schemaFileName("SHSE.SchemaCollections.json");
-	std::string filePath(FileUtils::GetPluginPath() + schemaFileName);
-	nlohmann::json_schema::json_validator validator;
 	try {
-		std::ifstream schemaFile(filePath);
-		if (schemaFile.fail()) {
-			throw FileNotFound(filePath.c_str());
-		}
-		nlohmann::json schema(nlohmann::json::parse(schemaFile));
-		validator.set_root_schema(schema); // insert root-schema
-	}
-	catch (const std::exception& e) {
-		REL_ERROR("JSON Schema {} not loadable, error:\n{}", filePath.c_str(), e.what());
-		return false;
-	}
-
-	REL_MESSAGE("JSON Schema {} parsed and validated", filePath.c_str());
-
-	try {
-		// Find and Load Collection Definitions using the validated schema
+		// Find Collection Definitions, then read and parse each concurrently. SHSE.SchemaCollections.json is enforced as
+		// each is parsed.
+		std::vector<std::tuple<std::filesystem::path, std::string, std::future<CollectionFileDefinition>>> pending;
 		const std::wregex collectionsFilePattern(L"SHSE.Collections\\.(.*)\\.json$");
 		for (const auto& nextFile : std::filesystem::directory_iterator(FileUtils::GetPluginPath()))
 		{
@@ -379,9 +491,17 @@ bool CollectionManager::LoadData(void)
 			}
 			// capture string at index 1 is the Collection Name, always present after a regex match
 			REL_MESSAGE("Load JSON Collection Definitions {} for Group {}", StringUtils::FromUnicode(fileName), StringUtils::FromUnicode(matches[1].str()));
-			if (LoadCollectionGroup(nextFile, StringUtils::FromUnicode(matches[1].str()), validator))
+			pending.emplace_back(nextFile.path(), StringUtils::FromUnicode(matches[1].str()),
+				std::async(std::launch::async, ReadCollectionFile, nextFile.path()));
+		}
+		// build and register Groups one at a time, in directory order
+		for (auto& file : pending)
+		{
+			const std::filesystem::path& defFile(std::get<0>(file));
+			const std::string& groupName(std::get<1>(file));
+			if (LoadCollectionGroup(defFile, groupName, std::get<2>(file)))
 			{
-				REL_MESSAGE("JSON Collection Definitions {}/{} parsed and validated", StringUtils::FromUnicode(fileName), StringUtils::FromUnicode(matches[1].str()));
+				REL_MESSAGE("JSON Collection Definitions {}/{} validated and built", StringUtils::FromUnicode(defFile.filename().generic_wstring()), groupName);
 			}
 		}
 	} catch (const std::exception& e) {
@@ -536,6 +656,8 @@ void CollectionManager::PolicySetRepeat(const std::string& groupName, const std:
 	{
 		matched->second->Policy().SetRepeat(allowRepeats);
 		matched->second->SetOverridesGroup(true);
+		InvalidateCollectibleDecisions();
+		++m_generation;
 	}
 }
 
@@ -548,6 +670,8 @@ void CollectionManager::PolicySetNotify(const std::string& groupName, const std:
 	{
 		matched->second->Policy().SetNotify(notify);
 		matched->second->SetOverridesGroup(true);
+		InvalidateCollectibleDecisions();
+		++m_generation;
 	}
 }
 
@@ -560,6 +684,8 @@ void CollectionManager::PolicySetAction(const std::string& groupName, const std:
 	{
 		matched->second->Policy().SetAction(action);
 		matched->second->SetOverridesGroup(true);
+		InvalidateCollectibleDecisions();
+		++m_generation;
 	}
 }
 
@@ -604,6 +730,8 @@ void CollectionManager::GroupPolicySetRepeat(const std::string& groupName, const
 	{
 		matched->second->Policy().SetRepeat(allowRepeats);
 		matched->second->SyncDefaultPolicy();
+		InvalidateCollectibleDecisions();
+		++m_generation;
 	}
 }
 
@@ -615,6 +743,8 @@ void CollectionManager::GroupPolicySetNotify(const std::string& groupName, const
 	{
 		matched->second->Policy().SetNotify(notify);
 		matched->second->SyncDefaultPolicy();
+		InvalidateCollectibleDecisions();
+		++m_generation;
 	}
 }
 
@@ -626,6 +756,8 @@ void CollectionManager::GroupPolicySetAction(const std::string& groupName, const
 	{
 		matched->second->Policy().SetAction(action);
 		matched->second->SyncDefaultPolicy();
+		InvalidateCollectibleDecisions();
+		++m_generation;
 	}
 }
 
@@ -704,14 +836,18 @@ void CollectionManager::ResolveMembership(void)
 	WindowsUtils::ScopedTimer elapsed("Resolve Collection Membership");
 #endif
 	std::unordered_set<const RE::TESForm*> uniqueMembers;
-	// record static members before resolving
+	// record static members before resolving - view is read in place, membership is not modified until after this
+	size_t staticMembers(0);
 	for (const auto& collection : m_allCollectionsByLabel)
 	{
-		for (const auto member : collection.second->Members())
+		const FormView members(collection.second->Members());
+		staticMembers += members.size();
+		for (const auto member : members)
 		{
 			RecordCollectibleForm(collection.second, member, uniqueMembers);
 		}
 	}
+	REL_MESSAGE("{} static members recorded from {} Collections", staticMembers, m_allCollectionsByLabel.size());
 
 	auto processFormType = [&](const RE::FormType formType) {
 		for (const auto form : RE::TESDataHandler::GetSingleton()->GetFormArray(formType))
@@ -738,7 +874,7 @@ void CollectionManager::ResolveMembership(void)
 	};
 	for (const auto& signature : SignatureCondition::ValidSignatures())
 	{
-		processFormType(signature.second);
+		processFormType(signature.value);
 	}
 	// named objects processed in DataCase::CategorizeLootables or otherwise Lootable, but not valid in SignatureCondition
 	std::vector<RE::FormType> extraFormTypes = {
@@ -756,24 +892,61 @@ void CollectionManager::ResolveMembership(void)
 		processFormType(extraFormType);
 	}
 	REL_MESSAGE("Collections contain {} unique objects", uniqueMembers.size());
+	PublishCandidates();
+	InvalidateCollectibleDecisions();
+	++m_generation;
+}
+
+// caller holds m_collectionLock
+void CollectionManager::PublishCandidates()
+{
+	auto candidates(std::make_shared<CandidateSet>());
+	candidates->m_formIDs.reserve(m_collectionsByFormID.size());
+	for (const auto& member : m_collectionsByFormID)
+	{
+		candidates->m_formIDs.insert(member.first);
+	}
+	for (const auto& member : m_collectionsByObjectType)
+	{
+		candidates->m_objectTypes.insert(member.first);
+	}
+	DBG_MESSAGE("Publish {} candidate FormIDs, {} candidate ObjectTypes", candidates->m_formIDs.size(),
+		candidates->m_objectTypes.size());
+	m_candidates.store(std::move(candidates), std::memory_order_release);
 }
 
 // clear state before game reload, including reset of item state
 void CollectionManager::Clear(void)
 {
 	REL_MESSAGE("Reset Collections");
+	// serialize with ProcessAddedItems, the added item queue allows only one consumer
+	RecursiveLockGuard guard(m_collectionLock);
 	// Flush membership state to allow testing
 	m_collectionsByFormID.clear();
 	// m_collectionsByObjectType is not cleared - it is based on one-time load of JSON files and therefore invariant
+	PublishCandidates();
 	for (auto collection : m_allCollectionsByLabel)
 	{
 		collection.second->Reset();
 	}
 
-	// reset player inventory last-known-good
-	m_lastInventoryCollectibles.clear();
+	// reset player inventory last-known-good, forcing a full rescan
+	m_inventoryCollectibleCounts.clear();
 	m_lastInventoryCheck = decltype(m_lastInventoryCheck)();
-	m_addedItemQueue.clear();
+	m_lastInventoryRescan = decltype(m_lastInventoryRescan)();
+	InventoryTracker::Instance().Reset();
+	std::vector<OwnedItem> discarded;
+	m_addedItemQueue.Drain(discarded);
+	m_addedItemQueue.TakeOverflow();
+	InvalidateCollectibleDecisions();
+	++m_generation;
+}
+
+// Collection activity depends on MCM settings
+void CollectionManager::RefreshSettings(void)
+{
+	RecursiveLockGuard guard(m_collectionLock);
+	InvalidateCollectibleDecisions();
 }
 
 // if this is a game reload, we must resolve membership after cosave data is applied
@@ -788,11 +961,23 @@ void CollectionManager::OnGameReload(void)
 
 void CollectionManager::AsJSON(nlohmann::json& j) const
 {
-	RecursiveLockGuard guard(m_collectionLock);
+	// Copy only what can change under the lock. The cosave worker builds the JSON after releasing it, so collecting
+	// an item is not held up by a snapshot. The shared Group keeps its Collection definitions alive meanwhile.
+	std::vector<std::tuple<std::shared_ptr<CollectionGroup>, CollectionPolicy, std::vector<CollectionState>>> groups;
+	{
+		RecursiveLockGuard guard(m_collectionLock);
+		groups.reserve(m_allGroupsByName.size());
+		for (const auto& collectionGroup : m_allGroupsByName)
+		{
+			groups.emplace_back(collectionGroup.second, collectionGroup.second->Policy(), collectionGroup.second->CollectionStates());
+		}
+	}
 	j["groups"] = nlohmann::json::array();
-	for (const auto& collectionGroup : m_allGroupsByName)
+	for (const auto& group : groups)
 	{
-		j["groups"].push_back(*collectionGroup.second);
+		nlohmann::json groupState;
+		std::get<0>(group)->StateAsJSON(groupState, std::get<1>(group), std::get<2>(group));
+		j["groups"].push_back(groupState);
 	}
 }
 
@@ -813,6 +998,8 @@ void CollectionManager::UpdateFrom(const nlohmann::json& j)
 		}
 		existing->second->UpdateFrom(group);
 	}
+	InvalidateCollectibleDecisions();
+	++m_generation;
 }
 
 void to_json(nlohmann::json& j, const CollectionManager& collectionManager)
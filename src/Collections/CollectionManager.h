@@ -19,12 +19,19 @@ http://www.fsf.org/licensing/licenses
 *************************************************************************/
 #pragma once
 
+#include <atomic>
+
 #include "Collections/Collection.h"
+#include "Collections/CollectionReader.h"
+#include "Utilities/BoundedMPSCQueue.h"
+#include <future>
 #include <tuple>
 
 namespace shse {
 
 typedef std::tuple<RE::TESBoundObject*, const INIFile::SecondaryType, const ObjectType> OwnedItem;
+// Collection Group file checked against its schema, with file size in bytes and read and parse time in microseconds
+typedef std::tuple<CollectionGroupDefinition, size_t, long long> CollectionFileDefinition;
 
 class CollectionManager {
 public:
@@ -75,18 +82,25 @@ public:
 
 	void AsJSON(nlohmann::json& j) const;
 	void UpdateFrom(const nlohmann::json& j);
+	// advances whenever state saved to the cosave changes
+	inline uint64_t Generation() const { return m_generation; }
 
 private:
 	bool LoadData(void);
-	bool LoadCollectionGroup(
-		const std::filesystem::path& defFile, const std::string& groupName, nlohmann::json_schema::json_validator& validator);
+	static CollectionFileDefinition ReadCollectionFile(const std::filesystem::path& defFile);
+	bool LoadCollectionGroup(const std::filesystem::path& defFile, const std::string& groupName,
+		std::future<CollectionFileDefinition>& fileDefinition);
 	void BuildDecisionTrees(const std::shared_ptr<CollectionGroup>& collectionGroup);
 	void RecordCollectibleForm(const std::shared_ptr<Collection>& collection, const RE::TESForm* form,
 		std::unordered_set<const RE::TESForm*>& uniqueMembers);
 	void ResolveMembership(void);
 	void AddToRelevantCollections(const ConditionMatcher& matcher, const float gameTime);
+	std::pair<bool, CollectibleHandling> EvaluateCollectible(const ConditionMatcher& matcher, const bool collectedOnThisScan) const;
+	void InvalidateCollectibleDecisions();
 	void ReconcileInventory(std::vector<OwnedItem>& additions);
+	void RescanInventory(std::vector<OwnedItem>& additions);
 	void EnqueueAddedItem(RE::TESBoundObject*, const INIFile::SecondaryType scope, const ObjectType objectType);
+	void PublishCandidates();
 
 	static constexpr size_t CollectedSpamLimit = 10;
 	size_t m_notifications;
@@ -96,6 +110,7 @@ private:
 	bool m_ready;
 
 	mutable RecursiveLock m_collectionLock;
+	std::atomic<uint64_t> m_generation = 0;
 	std::unordered_map<std::string, std::shared_ptr<Collection>> m_allCollectionsByLabel;
 	mutable std::multimap<std::string, std::string> m_activeCollectionsByGroupName;
 	std::unordered_map<std::string, std::string> m_mcmVisibleFileByGroupName;
@@ -104,10 +119,33 @@ private:
 	std::unordered_multimap<RE::FormID, std::shared_ptr<Collection>> m_collectionsByFormID;
 	std::unordered_multimap<ObjectType, std::shared_ptr<Collection>> m_collectionsByObjectType;
 
-	std::vector<OwnedItem> m_addedItemQueue;
-	std::unordered_set<const RE::TESForm*> m_lastInventoryCollectibles;
+	// added items arrive from script events and looting without taking m_collectionLock, drained by ProcessAddedItems
+	static constexpr size_t AddedItemQueueCapacity = 4096;
+	BoundedMPSCQueue<OwnedItem, AddedItemQueueCapacity> m_addedItemQueue;
+	// Immutable copy of the membership keys, republished when membership changes. Producers filter added items against
+	// it without m_collectionLock, so only possible members take a queue slot.
+	struct CandidateSet
+	{
+		std::unordered_set<RE::FormID> m_formIDs;
+		std::unordered_set<ObjectType> m_objectTypes;
+	};
+	std::atomic<std::shared_ptr<const CandidateSet>> m_candidates;
+	// snapshot of collectible counts in player inventory, maintained from container-changed events
+	std::unordered_map<RE::FormID, int32_t> m_inventoryCollectibleCounts;
 	std::chrono::time_point<std::chrono::high_resolution_clock> m_lastInventoryCheck;
+	std::chrono::time_point<std::chrono::high_resolution_clock> m_lastInventoryRescan;
 	std::unordered_set<RE::FormID> m_collectedOnThisScan;
+
+	// Memoized TreatAsCollectible outcome, per Form for (scope, ObjectType, already collected on this scan). Invalidated
+	// for a Form when it is observed by a no-repeat Collection, and in full on any policy, membership or settings change.
+	struct CollectibleDecision
+	{
+		INIFile::SecondaryType m_scope;
+		ObjectType m_objectType;
+		bool m_collectedOnThisScan;
+		std::pair<bool, CollectibleHandling> m_outcome;
+	};
+	std::unordered_map<RE::FormID, std::vector<CollectibleDecision>> m_collectibleDecisions;
 };
 
 void to_json(nlohmann::json& j, const CollectionManager& collectionManager);
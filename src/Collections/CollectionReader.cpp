@@ -0,0 +1,384 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#include "PrecompiledHeaders.h"
+
+#include "Collections/CollectionReader.h"
+
+namespace shse
+{
+
+namespace
+{
+
+constexpr std::string_view ActionValues[] = { "leave", "take", "glow", "print" };
+constexpr std::string_view OperatorValues[] = { "AND", "OR" };
+constexpr std::string_view MatchIfValues[] = { "equals", "startsWith", "contains", "omits", "notEquals" };
+constexpr std::string_view SignatureValues[] = { "ALCH", "ARMO", "BOOK", "INGR", "KEYM", "MISC", "SLGM", "WEAP" };
+constexpr std::string_view ScopeValues[] = { "deadBody", "container", "looseItem" };
+constexpr std::string_view CategoryValues[] = { "book", "skillbook", "spellbook", "bookRead", "spellbookRead", "skillbookRead",
+	"weapon", "enchantedWeapon", "armor", "enchantedArmor", "jewelry", "enchantedJewelry" };
+
+constexpr StringListRule PluginRule = { 1, 16, true, {}, false };
+constexpr StringListRule KeywordRule = { 1, 16, true, {}, false };
+constexpr StringListRule SignatureRule = { 1, 16, true, SignatureValues, false };
+constexpr StringListRule ScopeRule = { 1, 2, true, ScopeValues, false };
+constexpr StringListRule NamesRule = { 1, 16, true, {}, false };
+constexpr StringListRule CategoriesRule = { 1, 16, true, CategoryValues, false };
+
+void CheckAllowed(const std::string& value, const std::span<const std::string_view> allowed)
+{
+	if (std::find(allowed.begin(), allowed.end(), value) == allowed.end())
+	{
+		ReadNode::Reject("'" + value + "' is not an allowed value");
+	}
+}
+
+constexpr std::string_view PolicyMembers[] = { "action", "notify", "repeat" };
+
+class PolicyNode : public ObjectNode {
+public:
+	PolicyNode(PolicyDefinition& target) : ObjectNode(PolicyMembers), m_target(target) {}
+
+	virtual void MemberString(std::string&& value) override
+	{
+		if (m_member != Action)
+			return ObjectNode::MemberString(std::move(value));
+		CheckAllowed(value, ActionValues);
+		m_target.m_action = std::move(value);
+	}
+	virtual void MemberBoolean(const bool value) override
+	{
+		if (m_member == Notify)
+			m_target.m_notify = value;
+		else if (m_member == Repeat)
+			m_target.m_repeat = value;
+		else
+			ObjectNode::MemberBoolean(value);
+	}
+	virtual void End() override
+	{
+		Require(Action);
+		Require(Notify);
+		Require(Repeat);
+	}
+
+private:
+	enum Member : size_t { Action, Notify, Repeat };
+	PolicyDefinition& m_target;
+};
+
+constexpr std::string_view FormIDMembers[] = { "listPlugin", "formID" };
+
+class FormIDNode : public ObjectNode {
+public:
+	FormIDNode(std::pair<std::string, std::string>& target) : ObjectNode(FormIDMembers), m_target(target) {}
+
+	virtual void MemberString(std::string&& value) override
+	{
+		if (m_member == ListPlugin)
+		{
+			m_target.first = std::move(value);
+			return;
+		}
+		if (!IsFormIDPattern(value))
+		{
+			Reject("'" + value + "' does not match pattern [0-9 a-f A-F]{8}");
+		}
+		m_target.second = std::move(value);
+	}
+	virtual void End() override
+	{
+		Require(ListPlugin);
+		Require(FormID);
+	}
+
+private:
+	enum Member : size_t { ListPlugin, FormID };
+	std::pair<std::string, std::string>& m_target;
+};
+
+class FormListNode : public ReadNode {
+public:
+	FormListNode(std::vector<std::pair<std::string, std::string>>& target) : m_target(target) {}
+
+	virtual ReadNodePtr Object() override
+	{
+		return std::make_unique<FormIDNode>(m_target.emplace_back());
+	}
+	virtual void End() override
+	{
+		CheckItemCount(m_target.size(), 1, 5);
+		CheckUniqueItems(m_target);
+	}
+
+private:
+	std::vector<std::pair<std::string, std::string>>& m_target;
+};
+
+constexpr std::string_view NameMatchMembers[] = { "isNPC", "matchIf", "names" };
+
+class NameMatchNode : public ObjectNode {
+public:
+	NameMatchNode(NameMatchDefinition& target) : ObjectNode(NameMatchMembers), m_target(target) {}
+
+	virtual ReadNodePtr MemberArray() override
+	{
+		if (m_member != Names)
+			return ObjectNode::MemberArray();
+		return std::make_unique<StringListNode>(NamesRule, m_target.m_names);
+	}
+	virtual void MemberString(std::string&& value) override
+	{
+		if (m_member != MatchIf)
+			return ObjectNode::MemberString(std::move(value));
+		CheckAllowed(value, MatchIfValues);
+		m_target.m_matchIf = std::move(value);
+	}
+	virtual void MemberBoolean(const bool value) override
+	{
+		if (m_member != IsNPC)
+			return ObjectNode::MemberBoolean(value);
+		m_target.m_isNPC = value;
+	}
+	virtual void End() override
+	{
+		Require(IsNPC);
+		Require(MatchIf);
+		Require(Names);
+	}
+
+private:
+	enum Member : size_t { IsNPC, MatchIf, Names };
+	NameMatchDefinition& m_target;
+};
+
+class SubFilterListNode : public ReadNode {
+public:
+	SubFilterListNode(std::vector<FilterDefinition>& target) : m_target(target) {}
+	virtual ReadNodePtr Object() override;
+	virtual void End() override
+	{
+		CheckItemCount(m_target.size(), 1, 5);
+	}
+
+private:
+	std::vector<FilterDefinition>& m_target;
+};
+
+constexpr std::string_view ConditionMembers[] = {
+	"plugin", "formList", "forms", "keyword", "signature", "scope", "nameMatch", "subFilter" };
+
+// conditions are stored to the enclosing filter as read
+class ConditionNode : public ObjectNode {
+public:
+	ConditionNode(FilterDefinition& target) : ObjectNode(ConditionMembers), m_target(target) {}
+
+	virtual ReadNodePtr MemberObject() override
+	{
+		if (m_member != NameMatch)
+			return ObjectNode::MemberObject();
+		return std::make_unique<NameMatchNode>(m_target.m_nameMatch.emplace());
+	}
+	virtual ReadNodePtr MemberArray() override
+	{
+		switch (m_member)
+		{
+		case Plugin:
+			return std::make_unique<StringListNode>(PluginRule, m_target.m_plugins);
+		case FormList:
+			return std::make_unique<FormListNode>(m_target.m_formLists);
+		case Forms:
+			return std::make_unique<FormsListNode>(1, 32, true, m_target.m_forms);
+		case Keyword:
+			return std::make_unique<StringListNode>(KeywordRule, m_target.m_keywords);
+		case Signature:
+			return std::make_unique<StringListNode>(SignatureRule, m_target.m_signatures);
+		case Scope:
+			return std::make_unique<StringListNode>(ScopeRule, m_target.m_scopes);
+		case SubFilter:
+			return std::make_unique<SubFilterListNode>(m_target.m_subFilters);
+		default:
+			return ObjectNode::MemberArray();
+		}
+	}
+	virtual void End() override
+	{
+		// schema oneOf: 'forms' without 'nameMatch', or at least one of the other selective conditions
+		const bool formsOnly(Has(Forms) && !Has(NameMatch));
+		const bool selective(Has(NameMatch) || Has(Plugin) || Has(Keyword) || Has(FormList) || Has(Signature) || Has(SubFilter));
+		if (formsOnly == selective)
+		{
+			Reject(formsOnly ? "'forms' cannot be combined with other selective conditions except 'nameMatch'" :
+				"requires 'forms' or at least one of 'nameMatch', 'plugin', 'keyword', 'formList', 'signature', 'subFilter'");
+		}
+	}
+
+private:
+	enum Member : size_t { Plugin, FormList, Forms, Keyword, Signature, Scope, NameMatch, SubFilter };
+	FilterDefinition& m_target;
+};
+
+constexpr std::string_view FilterMembers[] = { "operator", "condition" };
+
+class FilterNode : public ObjectNode {
+public:
+	FilterNode(FilterDefinition& target) : ObjectNode(FilterMembers), m_target(target) {}
+
+	virtual ReadNodePtr MemberObject() override
+	{
+		if (m_member != Condition)
+			return ObjectNode::MemberObject();
+		return std::make_unique<ConditionNode>(m_target);
+	}
+	virtual void MemberString(std::string&& value) override
+	{
+		if (m_member != Operator)
+			return ObjectNode::MemberString(std::move(value));
+		CheckAllowed(value, OperatorValues);
+		m_target.m_isAnd = value == "AND";
+	}
+	virtual void End() override
+	{
+		Require(Operator);
+		Require(Condition);
+	}
+
+private:
+	enum Member : size_t { Operator, Condition };
+	FilterDefinition& m_target;
+};
+
+ReadNodePtr SubFilterListNode::Object()
+{
+	return std::make_unique<FilterNode>(m_target.emplace_back());
+}
+
+constexpr std::string_view CollectionMembers[] = { "name", "description", "policy", "rootFilter", "category" };
+
+class CollectionNode : public ObjectNode {
+public:
+	CollectionNode(CollectionDefinition& target) : ObjectNode(CollectionMembers), m_target(target) {}
+
+	virtual ReadNodePtr MemberObject() override
+	{
+		switch (m_member)
+		{
+		case Policy:
+			return std::make_unique<PolicyNode>(m_target.m_policy.emplace());
+		case RootFilter:
+			return std::make_unique<FilterNode>(m_target.m_rootFilter.emplace());
+		default:
+			return ObjectNode::MemberObject();
+		}
+	}
+	virtual ReadNodePtr MemberArray() override
+	{
+		if (m_member != Category)
+			return ObjectNode::MemberArray();
+		return std::make_unique<StringListNode>(CategoriesRule, m_target.m_categories);
+	}
+	virtual void MemberString(std::string&& value) override
+	{
+		if (m_member == Name)
+			m_target.m_name = std::move(value);
+		else if (m_member == Description)
+			m_target.m_description = std::move(value);
+		else
+			ObjectNode::MemberString(std::move(value));
+	}
+	virtual void End() override
+	{
+		Require(Name);
+		Require(Description);
+		// schema oneOf
+		if (Has(RootFilter) == Has(Category))
+		{
+			Reject("requires exactly one of 'rootFilter' and 'category'");
+		}
+	}
+
+private:
+	enum Member : size_t { Name, Description, Policy, RootFilter, Category };
+	CollectionDefinition& m_target;
+};
+
+class CollectionListNode : public ReadNode {
+public:
+	CollectionListNode(std::vector<CollectionDefinition>& target) : m_target(target) {}
+
+	virtual ReadNodePtr Object() override
+	{
+		return std::make_unique<CollectionNode>(m_target.emplace_back());
+	}
+	virtual void End() override
+	{
+		CheckItemCount(m_target.size(), 0, 128);
+	}
+
+private:
+	std::vector<CollectionDefinition>& m_target;
+};
+
+constexpr std::string_view GroupMembers[] = { "groupPolicy", "collections", "useMCM" };
+
+class GroupNode : public ObjectNode {
+public:
+	GroupNode(CollectionGroupDefinition& target) : ObjectNode(GroupMembers), m_target(target) {}
+
+	virtual ReadNodePtr MemberObject() override
+	{
+		if (m_member != GroupPolicy)
+			return ObjectNode::MemberObject();
+		return std::make_unique<PolicyNode>(m_target.m_groupPolicy);
+	}
+	virtual ReadNodePtr MemberArray() override
+	{
+		if (m_member != Collections)
+			return ObjectNode::MemberArray();
+		return std::make_unique<CollectionListNode>(m_target.m_collections);
+	}
+	virtual void MemberBoolean(const bool value) override
+	{
+		if (m_member != UseMCM)
+			return ObjectNode::MemberBoolean(value);
+		m_target.m_useMCM = value;
+	}
+	virtual void End() override
+	{
+		Require(GroupPolicy);
+		Require(Collections);
+		Require(UseMCM);
+	}
+
+private:
+	enum Member : size_t { GroupPolicy, Collections, UseMCM };
+	CollectionGroupDefinition& m_target;
+};
+
+}
+
+CollectionGroupDefinition ReadCollectionGroupDefinition(const std::string& text)
+{
+	CollectionGroupDefinition definition{};
+	ReadDefinition(text, std::make_unique<GroupNode>(definition));
+	return definition;
+}
+
+}
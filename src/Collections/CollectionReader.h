@@ -0,0 +1,75 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#pragma once
+
+#include <optional>
+
+#include "Utilities/DefinitionReader.h"
+
+namespace shse
+{
+
+struct PolicyDefinition {
+	std::string m_action;
+	bool m_notify;
+	bool m_repeat;
+};
+
+struct NameMatchDefinition {
+	bool m_isNPC;
+	std::string m_matchIf;
+	std::vector<std::string> m_names;
+};
+
+// A filter with its conditions as written in the file. The schema requires every condition list to have at least one
+// item, so an empty list is an absent condition.
+struct FilterDefinition {
+	bool m_isAnd;
+	std::vector<std::string> m_plugins;
+	std::vector<std::pair<std::string, std::string>> m_formLists;
+	FormsDefinition m_forms;
+	std::vector<std::string> m_keywords;
+	std::vector<std::string> m_signatures;
+	std::vector<std::string> m_scopes;
+	std::optional<NameMatchDefinition> m_nameMatch;
+	std::vector<FilterDefinition> m_subFilters;
+};
+
+// schema oneOf: a Collection has a rootFilter or a non-empty category list, never both
+struct CollectionDefinition {
+	std::string m_name;
+	std::string m_description;
+	std::optional<PolicyDefinition> m_policy;
+	std::optional<FilterDefinition> m_rootFilter;
+	std::vector<std::string> m_categories;
+};
+
+// Collection Group file content, already checked against SHSE.SchemaCollections.json. Plain std types only: reading
+// needs no game data, so it is safe off the main thread, and nothing is resolved until the whole file is accepted.
+struct CollectionGroupDefinition {
+	PolicyDefinition m_groupPolicy;
+	bool m_useMCM;
+	std::vector<CollectionDefinition> m_collections;
+};
+
+// Read a Collection Group file in one pass, enforcing SHSE.SchemaCollections.json inline. Throws DefinitionError.
+CollectionGroupDefinition ReadCollectionGroupDefinition(const std::string& text);
+
+}
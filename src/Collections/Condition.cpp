@@ -32,9 +32,9 @@ Condition::Condition() {}
 Condition::~Condition() {}
 
 // no static members
-std::unordered_set<const RE::TESForm*> Condition::StaticMembers() const
+FormView Condition::StaticMembers() const
 {
-	return std::unordered_set<const RE::TESForm*>();
+	return FormView();
 }
 
 nlohmann::json Condition::MakeJSON() const
@@ -162,18 +162,15 @@ FormsCondition::FormsCondition(const std::vector<std::pair<std::string, std::vec
 			newForms.push_back(form);
 		}
 		m_formsByPlugin.insert({ entry.first, newForms });
-		m_allForms.insert(newForms.cbegin(), newForms.cend());
+		m_allForms.insert(m_allForms.end(), newForms.cbegin(), newForms.cend());
+		std::sort(m_allForms.begin(), m_allForms.end());
+		m_allForms.erase(std::unique(m_allForms.begin(), m_allForms.end()), m_allForms.end());
 	}
 }
 
-std::unordered_set<const RE::TESForm*> FormsCondition::StaticMembers() const
-{ 
-	return m_allForms;
-}
-
 bool FormsCondition::operator()(const ConditionMatcher& matcher) const
 {
-	return m_allForms.contains(matcher.Form());
+	return std::binary_search(m_allForms.cbegin(), m_allForms.cend(), matcher.Form());
 }
 
 void FormsCondition::AsJSON(nlohmann::json& j) const
@@ -207,6 +204,7 @@ KeywordCondition::KeywordCondition(const std::vector<std::string>& keywords)
 		if (matched != keywordsLeft.end())
 		{
 			m_keywords.insert(keywordRecord);
+			KeywordIndex::Instance().Register(keywordRecord, m_keywordMask);
 			DBG_VMESSAGE("BGSKeyword recorded for {}", FormUtils::SafeGetFormEditorID(keywordRecord).c_str());
 			// eliminate the matched candidate input from JSON
 			keywordsLeft.erase(matched);
@@ -230,11 +228,7 @@ KeywordCondition::KeywordCondition(const std::vector<std::string>& keywords)
 
 bool KeywordCondition::operator()(const ConditionMatcher& matcher) const
 {
-	const RE::BGSKeywordForm* keywordHolder(matcher.Form()->As<RE::BGSKeywordForm>());
-	if (!keywordHolder)
-		return false;
-	return std::find_if(m_keywords.cbegin(), m_keywords.cend(),
-		[=](const RE::BGSKeyword* keyword) -> bool { return keywordHolder->HasKeyword(keyword); }) != m_keywords.cend();
+	return KeywordIndex::Instance().HasAny(matcher.Form(), m_keywordMask);
 }
 
 void KeywordCondition::AsJSON(nlohmann::json& j) const
@@ -275,38 +269,15 @@ void CategoryCondition::AsJSON(nlohmann::json& j) const
 	}
 }
 
-const std::unordered_map<std::string, RE::FormType> SignatureCondition::m_validSignatures = {
-	{"ALCH", RE::FormType::AlchemyItem},
-	{"ARMO", RE::FormType::Armor},
-	{"BOOK", RE::FormType::Book},
-	{"INGR", RE::FormType::Ingredient},
-	{"KEYM", RE::FormType::KeyMaster},
-	{"MISC", RE::FormType::Misc},
-	{"SLGM", RE::FormType::SoulGem},
-	{"WEAP", RE::FormType::Weapon}
-};
-
-const std::vector<RE::FormType> SignatureCondition::m_validFormTypes = {
-	RE::FormType::AlchemyItem,
-	RE::FormType::Armor,
-	RE::FormType::Book,
-	RE::FormType::Ingredient,
-	RE::FormType::KeyMaster,
-	RE::FormType::Misc,
-	RE::FormType::SoulGem,
-	RE::FormType::Weapon
-};
-
-// This is O(n) in TESV Record Type count but only happens during startup, and there are not many of them
 SignatureCondition::SignatureCondition(const std::vector<std::string>& signatures)
 {
 	for (const auto& signature : signatures)
 	{
-		auto matched(m_validSignatures.find(signature));
-		if (matched != m_validSignatures.cend())
+		const auto matched(EnumUtils::FindByName(m_validSignatures, signature));
+		if (matched)
 		{
-			m_formTypes.push_back(matched->second);
-			DBG_VMESSAGE("Record Signature {} mapped to FormType {}", signature.c_str(), static_cast<int>(matched->second));
+			m_formTypes.push_back(matched->value);
+			DBG_VMESSAGE("Record Signature {} mapped to FormType {}", signature.c_str(), static_cast<int>(matched->value));
 		}
 	}
 }
@@ -320,22 +291,18 @@ bool SignatureCondition::operator()(const ConditionMatcher& matcher) const
 std::string SignatureCondition::FormTypeAsSignature(const RE::FormType formType)
 {
 	// very short linear scan, for file dump
-	for (const auto validSignature : m_validSignatures)
-	{
-		if (validSignature.second == formType)
-			return validSignature.first;
-	}
-	return "";
+	const auto matched(EnumUtils::FindByValue(m_validSignatures, formType));
+	return matched ? std::string(matched->name) : "";
 }
 
-const decltype(SignatureCondition::m_validSignatures) SignatureCondition::ValidSignatures()
+const decltype(SignatureCondition::m_validSignatures)& SignatureCondition::ValidSignatures()
 {
 	return m_validSignatures;
 }
 
 bool SignatureCondition::IsValidFormType(const RE::FormType formType)
 {
-	return std::find(m_validFormTypes.cbegin(), m_validFormTypes.cend(), formType) != m_validFormTypes.cend();
+	return EnumUtils::FindByValue(m_validSignatures, formType) != nullptr;
 }
 
 void SignatureCondition::AsJSON(nlohmann::json& j) const
@@ -347,21 +314,15 @@ void SignatureCondition::AsJSON(nlohmann::json& j) const
 	}
 }
 
-const std::unordered_map<std::string, INIFile::SecondaryType> ScopeCondition::m_validScopes = {
-	{"deadBody", INIFile::SecondaryType::deadbodies},
-	{"container", INIFile::SecondaryType::containers},
-	{"looseItem", INIFile::SecondaryType::itemObjects}
-};
-
 ScopeCondition::ScopeCondition(const std::vector<std::string>& scopes)
 {
 	for (const auto& scope : scopes)
 	{
-		auto matched(m_validScopes.find(scope));
-		if (matched != m_validScopes.cend())
+		const auto matched(EnumUtils::FindByName(m_validScopes, scope));
+		if (matched)
 		{
-			m_scopes.push_back(matched->second);
-			std::string target(INIFile::GetInstance()->SecondaryTypeString(matched->second));
+			m_scopes.push_back(matched->value);
+			std::string target(INIFile::GetInstance()->SecondaryTypeString(matched->value));
 			DBG_VMESSAGE("Scope {} mapped to FormType {}", scope.c_str(), target.c_str());
 		}
 	}
@@ -383,12 +344,8 @@ bool ScopeCondition::operator()(const ConditionMatcher& matcher) const
 std::string ScopeCondition::SecondaryTypeAsScope(const INIFile::SecondaryType scope)
 {
 	// very short linear scan, for file dump
-	for (const auto validScope : m_validScopes)
-	{
-		if (validScope.second == scope)
-			return validScope.first;
-	}
-	return "";
+	const auto matched(EnumUtils::FindByValue(m_validScopes, scope));
+	return matched ? std::string(matched->name) : "";
 }
 
 void ScopeCondition::AsJSON(nlohmann::json& j) const
@@ -468,6 +425,14 @@ FilterTree::FilterTree(const Operator op, const unsigned int depth) : m_operator
 
 void FilterTree::AddCondition(std::unique_ptr<Condition> condition)
 {
+	const FormView forms(condition->StaticMembers());
+	if (!forms.empty())
+	{
+		std::vector<const RE::TESForm*> merged;
+		merged.reserve(m_staticMembers.size() + forms.size());
+		std::set_union(m_staticMembers.cbegin(), m_staticMembers.cend(), forms.begin(), forms.end(), std::back_inserter(merged));
+		m_staticMembers.swap(merged);
+	}
 	m_conditions.push_back(std::move(condition));
 }
 
@@ -492,17 +457,6 @@ bool FilterTree::operator()(const ConditionMatcher& matcher) const
 	return m_operator == Operator::And;
 }
 
-std::unordered_set<const RE::TESForm*> FilterTree::StaticMembers() const
-{
-	std::unordered_set<const RE::TESForm*> aggregated;
-	for (const auto& condition : m_conditions)
-	{
-		auto forms(condition->StaticMembers());
-		aggregated.insert(forms.cbegin(), forms.cend());
-	}
-	return aggregated;
-}
-
 void FilterTree::AsJSON(nlohmann::json& j) const
 {
 	nlohmann::json tree(nlohmann::json::object());
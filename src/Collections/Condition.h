@@ -19,19 +19,25 @@ http://www.fsf.org/licensing/licenses
 *************************************************************************/
 #pragma once
 
+#include <span>
+
 #include "Data/iniSettings.h"
+#include "Data/KeywordIndex.h"
 
 namespace shse {
 
 	class ConditionMatcher;
 
+	// Immutable view of Forms materialized once by the owner, valid until the owner is modified or destroyed
+	typedef std::span<const RE::TESForm* const> FormView;
+
 	bool CanBeCollected(RE::TESForm* form);
 
 	class Condition {
 	public:
 		virtual ~Condition();
 
-		virtual std::unordered_set<const RE::TESForm*> StaticMembers() const;
+		virtual FormView StaticMembers() const;
 		virtual bool operator()(const ConditionMatcher& matcher) const = 0;
 		nlohmann::json MakeJSON() const;
 		virtual void AsJSON(nlohmann::json& j) const = 0;
@@ -64,12 +70,13 @@ namespace shse {
 	class FormsCondition : public Condition {
 	public:
 		FormsCondition(const std::vector<std::pair<std::string, std::vector<std::string>>>& pluginForms);
-		virtual std::unordered_set<const RE::TESForm*> StaticMembers() const override;
+		virtual inline FormView StaticMembers() const override { return m_allForms; }
 		virtual bool operator()(const ConditionMatcher& matcher) const;
 		virtual void AsJSON(nlohmann::json& j) const override;
 
 	private:
-		std::unordered_set<const RE::TESForm*> m_allForms;
+		// sorted and unique
+		std::vector<const RE::TESForm*> m_allForms;
 		std::unordered_map<std::string, std::vector<RE::TESForm*>> m_formsByPlugin;
 	};
 
@@ -81,6 +88,7 @@ namespace shse {
 
 	private:
 		std::unordered_set<const RE::BGSKeyword*> m_keywords;
+		KeywordMask m_keywordMask;
 	};
 
 	class CategoryCondition : public Condition {
@@ -99,17 +107,27 @@ namespace shse {
 
 	class SignatureCondition : public Condition {
 	private:
-		static const std::unordered_map<std::string, RE::FormType> m_validSignatures;
-		static const std::vector<RE::FormType> m_validFormTypes;
+		// sorted by signature for binary search
+		static constexpr EnumUtils::EnumNameTable<RE::FormType, 8> m_validSignatures = {{
+			{RE::FormType::AlchemyItem, "ALCH"},
+			{RE::FormType::Armor, "ARMO"},
+			{RE::FormType::Book, "BOOK"},
+			{RE::FormType::Ingredient, "INGR"},
+			{RE::FormType::KeyMaster, "KEYM"},
+			{RE::FormType::Misc, "MISC"},
+			{RE::FormType::SoulGem, "SLGM"},
+			{RE::FormType::Weapon, "WEAP"}
+		}};
+		static_assert(EnumUtils::HasUniqueEntries(m_validSignatures) && EnumUtils::IsSortedByName(m_validSignatures));
 		std::vector<RE::FormType> m_formTypes;
 
 	public:
 		// Store Form Types to match for this collection. Schema enforces uniqueness and validity in input list.
-		// The list below must match the JSON schema and CommonLibSSE RE::FormType.
+		// The list above must match the JSON schema and CommonLibSSE RE::FormType.
 
 		SignatureCondition(const std::vector<std::string>& signatures);
 		virtual bool operator()(const ConditionMatcher& matcher) const;
-		static const decltype(m_validSignatures) ValidSignatures();
+		static const decltype(m_validSignatures)& ValidSignatures();
 		static bool IsValidFormType(const RE::FormType formType);
 		virtual void AsJSON(nlohmann::json& j) const override;
 		static std::string FormTypeAsSignature(const RE::FormType formType);
@@ -124,7 +142,13 @@ namespace shse {
 
 	private:
 		std::vector<INIFile::SecondaryType> m_scopes;
-		static const std::unordered_map<std::string, INIFile::SecondaryType> m_validScopes;
+		// sorted by scope name for binary search
+		static constexpr EnumUtils::EnumNameTable<INIFile::SecondaryType, 3> m_validScopes = {{
+			{INIFile::SecondaryType::containers, "container"},
+			{INIFile::SecondaryType::deadbodies, "deadBody"},
+			{INIFile::SecondaryType::itemObjects, "looseItem"}
+		}};
+		static_assert(EnumUtils::HasUniqueEntries(m_validScopes) && EnumUtils::IsSortedByName(m_validScopes));
 	};
 
 	// order favours the most permissive, and they are evaluated in this order
@@ -137,37 +161,26 @@ namespace shse {
 		Omits
 	};
 
+	// indexed by NameMatchType, Invalid has no name
+	constexpr EnumUtils::EnumNameTable<NameMatchType, size_t(NameMatchType::Omits) + 1> NameMatchTypeNames = {{
+		{NameMatchType::Contains, "contains"},
+		{NameMatchType::StartsWith, "startsWith"},
+		{NameMatchType::Equals, "equals"},
+		{NameMatchType::NotEquals, "notEquals"},
+		{NameMatchType::Omits, "omits"}
+	}};
+	static_assert(EnumUtils::IsDense(NameMatchTypeNames) && EnumUtils::HasUniqueEntries(NameMatchTypeNames));
+	constexpr auto NameMatchTypesByName(EnumUtils::SortedByName(NameMatchTypeNames));
+
 	inline NameMatchType NameMatchTypeByName(const std::string& nameMatch)
 	{
-		if (nameMatch == "contains")
-			return NameMatchType::Contains;
-		if (nameMatch == "startsWith")
-			return NameMatchType::StartsWith;
-		if (nameMatch == "equals")
-			return NameMatchType::Equals;
-		if (nameMatch == "notEquals")
-			return NameMatchType::NotEquals;
-		if (nameMatch == "omits")
-			return NameMatchType::Omits;
-		return NameMatchType::Invalid;
+		const auto matched(EnumUtils::FindByName(NameMatchTypesByName, nameMatch));
+		return matched ? matched->value : NameMatchType::Invalid;
 	}
 
 	inline std::string NameMatchTypeName(const NameMatchType nameMatchType)
 	{
-		switch (nameMatchType) {
-		case NameMatchType::Contains:
-			return "contains";
-		case NameMatchType::StartsWith:
-			return "startsWith";
-		case NameMatchType::Equals:
-			return "equals";
-		case NameMatchType::NotEquals:
-			return "notEquals";
-		case NameMatchType::Omits:
-			return "omits";
-		default:
-			return "";
-		}
+		return std::string(EnumUtils::NameOf(NameMatchTypeNames, nameMatchType, ""));
 	}
 
 	class NameMatchCondition : public Condition {
@@ -202,13 +215,15 @@ namespace shse {
 		virtual bool operator()(const ConditionMatcher& matcher) const;
 		virtual void AsJSON(nlohmann::json& j) const override;
 		void AddCondition(std::unique_ptr<Condition> condition);
-		virtual std::unordered_set<const RE::TESForm*> StaticMembers() const override;
+		virtual inline FormView StaticMembers() const override { return m_staticMembers; }
 		virtual std::vector<ObjectType> GetObjectTypes(void) const override { return std::vector<ObjectType>(); }
 
 	private:
 		Operator m_operator;
 		unsigned int m_depth;
 		std::vector<std::unique_ptr<Condition>> m_conditions;
+		// union of child static members, sorted and unique - merged as each fully-parsed child is added
+		std::vector<const RE::TESForm*> m_staticMembers;
 	};
 
 	class CategoryRule : public ItemRule {
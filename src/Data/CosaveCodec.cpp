@@ -0,0 +1,585 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#include "PrecompiledHeaders.h"
+
+#include <bit>
+#include <deque>
+
+#include "Data/CosaveCodec.h"
+#include "Utilities/utils.h"
+
+namespace shse
+{
+
+namespace
+{
+
+enum class ValueTag : uint8_t
+{
+	Null = 0,
+	False,
+	True,
+	Integer,
+	Unsigned,
+	Float,
+	Double,
+	String,
+	FormID,
+	Array,
+	Object,
+	Table
+};
+
+enum class ColumnKind : uint8_t
+{
+	Values = 0,
+	FloatDelta,
+	FloatVectorDelta
+};
+// column has absent rows, presence bitmap follows the column header
+constexpr uint8_t SparseColumn(0x80);
+
+inline bool IsExactFloat(const nlohmann::json& value)
+{
+	if (!value.is_number_float())
+		return false;
+	const double number(value.get<double>());
+	return static_cast<double>(static_cast<float>(number)) == number;
+}
+
+inline uint32_t FloatBits(const nlohmann::json& value)
+{
+	return std::bit_cast<uint32_t>(static_cast<float>(value.get<double>()));
+}
+
+inline uint64_t ZigZag(const int64_t value)
+{
+	return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+inline int64_t UnZigZag(const uint64_t value)
+{
+	return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+// StringUtils::FromFormID output, which is what every subsystem writes for a FormID
+bool IsFormIDString(const std::string& str)
+{
+	if (str.length() != 8)
+		return false;
+	return std::all_of(str.cbegin(), str.cend(), [](const char c) -> bool { return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f'); });
+}
+
+RE::FormID HexToFormID(const std::string& str)
+{
+	RE::FormID formID(0);
+	for (const char c : str)
+	{
+		formID = (formID << 4) | static_cast<RE::FormID>(c <= '9' ? c - '0' : c - 'a' + 10);
+	}
+	return formID;
+}
+
+// Output goes straight to the stream buffer, so the encoded body is never staged in full
+class Writer
+{
+public:
+	Writer(std::streambuf& encoded) : m_output(encoded)
+	{
+	}
+
+	void Encode(const nlohmann::json& j)
+	{
+		WriteValue(j);
+	}
+
+private:
+	void Put(const char* bytes, const size_t count)
+	{
+		if (m_output.sputn(bytes, static_cast<std::streamsize>(count)) != static_cast<std::streamsize>(count))
+			throw std::runtime_error("Cosave binary record output failed");
+	}
+
+	inline void WriteByte(const uint8_t byte)
+	{
+		if (std::streambuf::traits_type::eq_int_type(m_output.sputc(static_cast<char>(byte)), std::streambuf::traits_type::eof()))
+			throw std::runtime_error("Cosave binary record output failed");
+	}
+	inline void WriteTag(const ValueTag tag) { WriteByte(static_cast<uint8_t>(tag)); }
+
+	void WriteVarint(uint64_t value)
+	{
+		while (value >= 0x80)
+		{
+			WriteByte(static_cast<uint8_t>(value | 0x80));
+			value >>= 7;
+		}
+		WriteByte(static_cast<uint8_t>(value));
+	}
+
+	template <typename T>
+	void WriteRaw(const T value)
+	{
+		const auto bytes(std::bit_cast<std::array<char, sizeof(T)>>(value));
+		Put(bytes.data(), bytes.size());
+	}
+
+	// A string is written in full at first use, as 0 then length and bytes, and takes the next index. Later uses
+	// write index + 1. The reader builds the same table as it goes.
+	void WriteStringIndex(const std::string& str)
+	{
+		const auto inserted(m_indexByString.insert({ str, static_cast<uint32_t>(m_indexByString.size()) }));
+		if (inserted.second)
+		{
+			WriteVarint(0);
+			WriteVarint(str.length());
+			Put(str.data(), str.length());
+			return;
+		}
+		WriteVarint(uint64_t(inserted.first->second) + 1);
+	}
+
+	void WriteFloatDelta(uint32_t& previous, const nlohmann::json& value)
+	{
+		const uint32_t bits(FloatBits(value));
+		WriteVarint(ZigZag(static_cast<int32_t>(bits - previous)));
+		previous = bits;
+	}
+
+	void WriteValue(const nlohmann::json& value)
+	{
+		switch (value.type())
+		{
+		case nlohmann::json::value_t::null:
+			WriteTag(ValueTag::Null);
+			break;
+		case nlohmann::json::value_t::boolean:
+			WriteTag(value.get<bool>() ? ValueTag::True : ValueTag::False);
+			break;
+		case nlohmann::json::value_t::number_integer:
+			WriteTag(ValueTag::Integer);
+			WriteVarint(ZigZag(value.get<int64_t>()));
+			break;
+		case nlohmann::json::value_t::number_unsigned:
+			WriteTag(ValueTag::Unsigned);
+			WriteVarint(value.get<uint64_t>());
+			break;
+		case nlohmann::json::value_t::number_float:
+			if (IsExactFloat(value))
+			{
+				WriteTag(ValueTag::Float);
+				WriteRaw(static_cast<float>(value.get<double>()));
+			}
+			else
+			{
+				WriteTag(ValueTag::Double);
+				WriteRaw(value.get<double>());
+			}
+			break;
+		case nlohmann::json::value_t::string:
+		{
+			const std::string& str(value.get_ref<const std::string&>());
+			if (IsFormIDString(str))
+			{
+				WriteTag(ValueTag::FormID);
+				WriteVarint(HexToFormID(str));
+			}
+			else
+			{
+				WriteTag(ValueTag::String);
+				WriteStringIndex(str);
+			}
+			break;
+		}
+		case nlohmann::json::value_t::array:
+			if (!WriteTable(value))
+			{
+				WriteTag(ValueTag::Array);
+				WriteVarint(value.size());
+				for (const auto& element : value)
+				{
+					WriteValue(element);
+				}
+			}
+			break;
+		case nlohmann::json::value_t::object:
+			WriteTag(ValueTag::Object);
+			WriteVarint(value.size());
+			for (const auto& element : value.items())
+			{
+				WriteStringIndex(element.key());
+				WriteValue(element.value());
+			}
+			break;
+		default:
+			throw std::runtime_error("Cosave JSON value type not encodable");
+		}
+	}
+
+	// array of objects, written column by column so that like values are adjacent
+	bool WriteTable(const nlohmann::json& rows)
+	{
+		if (rows.size() < 2 || !std::all_of(rows.cbegin(), rows.cend(), [](const nlohmann::json& row) { return row.is_object(); }))
+			return false;
+		std::vector<std::string> columns;
+		std::unordered_set<std::string> seen;
+		for (const auto& row : rows)
+		{
+			for (const auto& element : row.items())
+			{
+				if (seen.insert(element.key()).second)
+				{
+					columns.push_back(element.key());
+				}
+			}
+		}
+		if (columns.empty())
+			return false;
+		WriteTag(ValueTag::Table);
+		WriteVarint(rows.size());
+		WriteVarint(columns.size());
+		for (const std::string& column : columns)
+		{
+			WriteColumn(rows, column);
+		}
+		return true;
+	}
+
+	void WriteColumn(const nlohmann::json& rows, const std::string& column)
+	{
+		std::vector<uint8_t> presence((rows.size() + 7) / 8, 0);
+		std::vector<const nlohmann::json*> values;
+		values.reserve(rows.size());
+		size_t index(0);
+		for (const auto& row : rows)
+		{
+			const auto value(row.find(column));
+			if (value != row.cend())
+			{
+				presence[index / 8] |= static_cast<uint8_t>(1 << (index % 8));
+				values.push_back(&*value);
+			}
+			++index;
+		}
+		ColumnKind kind(ColumnKind::Values);
+		size_t dimensions(0);
+		if (std::all_of(values.cbegin(), values.cend(), [](const nlohmann::json* value) { return IsExactFloat(*value); }))
+		{
+			kind = ColumnKind::FloatDelta;
+		}
+		else if (values.front()->is_array() && !values.front()->empty())
+		{
+			dimensions = values.front()->size();
+			if (std::all_of(values.cbegin(), values.cend(), [=](const nlohmann::json* value) {
+				return value->is_array() && value->size() == dimensions &&
+					std::all_of(value->cbegin(), value->cend(), IsExactFloat);
+			}))
+			{
+				kind = ColumnKind::FloatVectorDelta;
+			}
+		}
+
+		WriteStringIndex(column);
+		const bool sparse(values.size() < rows.size());
+		WriteByte(static_cast<uint8_t>(kind) | (sparse ? SparseColumn : 0));
+		if (sparse)
+		{
+			Put(reinterpret_cast<const char*>(presence.data()), presence.size());
+		}
+		switch (kind)
+		{
+		case ColumnKind::FloatDelta:
+		{
+			uint32_t previous(0);
+			for (const auto value : values)
+			{
+				WriteFloatDelta(previous, *value);
+			}
+			break;
+		}
+		case ColumnKind::FloatVectorDelta:
+		{
+			WriteVarint(dimensions);
+			for (size_t dimension = 0; dimension < dimensions; ++dimension)
+			{
+				uint32_t previous(0);
+				for (const auto value : values)
+				{
+					WriteFloatDelta(previous, (*value)[dimension]);
+				}
+			}
+			break;
+		}
+		default:
+			for (const auto value : values)
+			{
+				WriteValue(*value);
+			}
+			break;
+		}
+	}
+
+	std::streambuf& m_output;
+	std::unordered_map<std::string, uint32_t> m_indexByString;
+};
+
+class Reader
+{
+public:
+	Reader(std::streambuf& encoded, const size_t length) : m_input(encoded), m_remaining(length)
+	{
+	}
+
+	nlohmann::json Decode()
+	{
+		nlohmann::json result(ReadValue(0));
+		if (m_remaining > 0 || !traits_type::eq_int_type(m_input.sgetc(), traits_type::eof()))
+			throw std::runtime_error("Cosave binary record has trailing data");
+		return result;
+	}
+
+private:
+	typedef std::streambuf::traits_type traits_type;
+
+	// input length is declared up front, so a short read means the record is truncated or corrupt
+	void Require(const size_t bytes)
+	{
+		if (bytes > m_remaining)
+			throw std::runtime_error("Cosave binary record truncated");
+		m_remaining -= bytes;
+	}
+
+	void ReadBytes(char* bytes, const size_t count)
+	{
+		Require(count);
+		if (m_input.sgetn(bytes, static_cast<std::streamsize>(count)) != static_cast<std::streamsize>(count))
+			throw std::runtime_error("Cosave binary record truncated");
+	}
+
+	uint8_t ReadByte()
+	{
+		Require(1);
+		const auto next(m_input.sbumpc());
+		if (traits_type::eq_int_type(next, traits_type::eof()))
+			throw std::runtime_error("Cosave binary record truncated");
+		return static_cast<uint8_t>(traits_type::to_char_type(next));
+	}
+
+	uint64_t ReadVarint()
+	{
+		uint64_t value(0);
+		for (unsigned int shift = 0; shift < 64; shift += 7)
+		{
+			const uint8_t byte(ReadByte());
+			value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+			if (!(byte & 0x80))
+				return value;
+		}
+		throw std::runtime_error("Cosave binary record has malformed varint");
+	}
+
+	// element counts are bounded by the remaining input, which guards allocation against corrupt data
+	size_t ReadCount()
+	{
+		const uint64_t count(ReadVarint());
+		if (count > m_remaining * 8 + 8)
+			throw std::runtime_error("Cosave binary record has invalid count");
+		return static_cast<size_t>(count);
+	}
+
+	template <typename T>
+	T ReadRaw()
+	{
+		std::array<char, sizeof(T)> bytes;
+		ReadBytes(bytes.data(), bytes.size());
+		return std::bit_cast<T>(bytes);
+	}
+
+	// strings are defined at first use, see Writer::WriteStringIndex
+	const std::string& ReadString()
+	{
+		const uint64_t reference(ReadVarint());
+		if (reference == 0)
+		{
+			std::string& str(m_strings.emplace_back(ReadCount(), '\0'));
+			ReadBytes(str.data(), str.length());
+			return str;
+		}
+		if (reference > m_strings.size())
+			throw std::runtime_error("Cosave binary record has invalid string index");
+		return m_strings[static_cast<size_t>(reference - 1)];
+	}
+
+	float ReadFloatDelta(uint32_t& previous)
+	{
+		previous += static_cast<uint32_t>(static_cast<int32_t>(UnZigZag(ReadVarint())));
+		return std::bit_cast<float>(previous);
+	}
+
+	// Real records nest a few levels. A corrupt record could nest at 2 bytes per level and overflow the stack.
+	static constexpr unsigned int MaxDepth = 16;
+
+	nlohmann::json ReadValue(const unsigned int depth)
+	{
+		if (depth > MaxDepth)
+			throw std::runtime_error("Cosave binary record nested too deeply");
+		switch (static_cast<ValueTag>(ReadByte()))
+		{
+		case ValueTag::Null:
+			return nlohmann::json();
+		case ValueTag::False:
+			return false;
+		case ValueTag::True:
+			return true;
+		case ValueTag::Integer:
+			return UnZigZag(ReadVarint());
+		case ValueTag::Unsigned:
+			return ReadVarint();
+		case ValueTag::Float:
+			return ReadRaw<float>();
+		case ValueTag::Double:
+			return ReadRaw<double>();
+		case ValueTag::String:
+			return ReadString();
+		case ValueTag::FormID:
+			return StringUtils::FromFormID(static_cast<RE::FormID>(ReadVarint()));
+		case ValueTag::Array:
+		{
+			const size_t count(ReadCount());
+			nlohmann::json result(nlohmann::json::array());
+			for (size_t index = 0; index < count; ++index)
+			{
+				result.push_back(ReadValue(depth + 1));
+			}
+			return result;
+		}
+		case ValueTag::Object:
+		{
+			const size_t count(ReadCount());
+			nlohmann::json result(nlohmann::json::object());
+			for (size_t index = 0; index < count; ++index)
+			{
+				const std::string& key(ReadString());
+				result[key] = ReadValue(depth + 1);
+			}
+			return result;
+		}
+		case ValueTag::Table:
+			return ReadTable(depth);
+		default:
+			throw std::runtime_error("Cosave binary record has invalid value tag");
+		}
+	}
+
+	nlohmann::json ReadTable(const unsigned int depth)
+	{
+		const size_t rowCount(ReadCount());
+		const size_t columns(ReadCount());
+		std::vector<nlohmann::json> rows(rowCount, nlohmann::json::object());
+		for (size_t column = 0; column < columns; ++column)
+		{
+			const std::string& key(ReadString());
+			const uint8_t header(ReadByte());
+			std::vector<size_t> present;
+			present.reserve(rowCount);
+			if (header & SparseColumn)
+			{
+				std::vector<char> presence((rowCount + 7) / 8);
+				ReadBytes(presence.data(), presence.size());
+				for (size_t row = 0; row < rowCount; ++row)
+				{
+					if (static_cast<uint8_t>(presence[row / 8]) & (1 << (row % 8)))
+					{
+						present.push_back(row);
+					}
+				}
+			}
+			else
+			{
+				for (size_t row = 0; row < rowCount; ++row)
+				{
+					present.push_back(row);
+				}
+			}
+			switch (static_cast<ColumnKind>(header & ~SparseColumn))
+			{
+			case ColumnKind::Values:
+				for (const size_t row : present)
+				{
+					rows[row][key] = ReadValue(depth + 2);
+				}
+				break;
+			case ColumnKind::FloatDelta:
+			{
+				uint32_t previous(0);
+				for (const size_t row : present)
+				{
+					rows[row][key] = ReadFloatDelta(previous);
+				}
+				break;
+			}
+			case ColumnKind::FloatVectorDelta:
+			{
+				const size_t dimensions(ReadCount());
+				for (const size_t row : present)
+				{
+					rows[row][key] = nlohmann::json::array();
+				}
+				for (size_t dimension = 0; dimension < dimensions; ++dimension)
+				{
+					uint32_t previous(0);
+					for (const size_t row : present)
+					{
+						rows[row][key].push_back(ReadFloatDelta(previous));
+					}
+				}
+				break;
+			}
+			default:
+				throw std::runtime_error("Cosave binary record has invalid column kind");
+			}
+		}
+		nlohmann::json result(nlohmann::json::array());
+		for (auto& row : rows)
+		{
+			result.push_back(std::move(row));
+		}
+		return result;
+	}
+
+	std::streambuf& m_input;
+	size_t m_remaining;
+	// references stay valid as strings are added
+	std::deque<std::string> m_strings;
+};
+
+}
+
+void CosaveCodec::Encode(const nlohmann::json& j, std::streambuf& encoded)
+{
+	Writer(encoded).Encode(j);
+}
+
+nlohmann::json CosaveCodec::Decode(std::streambuf& encoded, const size_t length)
+{
+	return Reader(encoded, length).Decode();
+}
+
+}
@@ -0,0 +1,40 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#pragma once
+
+namespace shse
+{
+
+// Compact binary form of a cosave JSON record, used for record version 2. Each subsystem's JSON DOM round-trips
+// losslessly, so rehydration via UpdateFrom is shared with version 1 text records.
+// - object keys and string values are written in full at first use and referenced by index after that
+// - 8-digit hex FormID strings are written as varints
+// - arrays of objects are written column by column, with float columns (game time, position) delta-coded
+// Encoded output and input are streamed with nothing staged, so the record can be compressed or inflated in place.
+class CosaveCodec
+{
+public:
+	// throws std::runtime_error if the output rejects data
+	static void Encode(const nlohmann::json& j, std::streambuf& encoded);
+	// reads exactly length bytes, throws std::runtime_error on malformed input
+	static nlohmann::json Decode(std::streambuf& encoded, const size_t length);
+};
+
+}
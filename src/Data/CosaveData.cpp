@@ -19,8 +19,10 @@ http://www.fsf.org/licensing/licenses
 *************************************************************************/
 #include "PrecompiledHeaders.h"
 #include "Collections/CollectionManager.h"
+#include "Data/CosaveCodec.h"
 #include "Data/CosaveData.h"
 #include "Data/LoadOrder.h"
+#include "Utilities/BrotliStream.h"
 #include "Utilities/utils.h"
 #include "WorldState/ActorTracker.h"
 #include "WorldState/AdventureTargets.h"
@@ -38,6 +40,24 @@ constexpr const char* PRTYFILE("PRTY.compressed.json");
 constexpr const char* VCTMFILE("VCTM.compressed.json");
 #endif
 
+namespace
+{
+
+// output LoadOrder, Collection Groups - Definitions and Members, Location history, Followers-in-Party history,
+// Party Victims, Adventure Events
+template <typename F>
+bool ForEachRecord(F&& process)
+{
+	return process('LORD', LoadOrder::Instance()) &&
+		process('COLL', CollectionManager::Instance()) &&
+		process('PLAC', VisitedPlaces::Instance()) &&
+		process('PRTY', PartyMembers::Instance()) &&
+		process('VCTM', ActorTracker::Instance()) &&
+		process('ADVN', AdventureTargets::Instance());
+}
+
+}
+
 std::unique_ptr<CosaveData> CosaveData::m_instance;
 
 CosaveData& CosaveData::Instance()
@@ -64,6 +84,13 @@ void CosaveData::Clear()
 
 	RecursiveLockGuard guard(m_cosaveLock);
 	m_records.clear();
+	m_cachedRecords.clear();
+}
+
+// SKSE record types are four-character constants, 'LORD' etc.
+std::string CosaveData::RecordTagName(const uint32_t tag)
+{
+	return std::string({ char(tag >> 24), char(tag >> 16), char(tag >> 8), char(tag) });
 }
 
 void CosaveData::SeedState()
@@ -73,25 +100,44 @@ void CosaveData::SeedState()
 	for (const auto& record : m_records)
 	{
 		REL_MESSAGE("Seed state from cosave data {}", SerializationRecordName(record.first));
+		const LoadedRecord& loaded(record.second);
 		try {
+			if (record.first == SerializationRecordType::PlacesVisited && loaded.m_version == ChunkedRecordVersion)
+			{
+				// history is applied a game day at a time, so the JSON for the whole history is never built
+				VisitedPlaces::Instance().Reset();
+				size_t chunks(0);
+				if (!DecodeChunks(loaded.m_tag, loaded.m_record, [&](const nlohmann::json& chunk) {
+					VisitedPlaces::Instance().AppendFrom(chunk);
+					++chunks;
+				}))
+				{
+					break;
+				}
+				REL_MESSAGE("Cosave Visited Places seeded from {} chunks, {} days", chunks, VisitedPlaces::Instance().DaysWithVisits());
+				continue;
+			}
+			nlohmann::json state;
+			if (!DecodeRecord(loaded.m_tag, loaded.m_version, loaded.m_record, state))
+				break;
 			switch (record.first) {
 			case SerializationRecordType::LoadOrder:
-				LoadOrder::Instance().UpdateFrom(record.second);
+				LoadOrder::Instance().UpdateFrom(state);
 				break;
 			case SerializationRecordType::Collections:
-				CollectionManager::Instance().UpdateFrom(record.second);
+				CollectionManager::Instance().UpdateFrom(state);
 				break;
 			case SerializationRecordType::PlacesVisited:
-				VisitedPlaces::Instance().UpdateFrom(record.second);
+				VisitedPlaces::Instance().UpdateFrom(state);
 				break;
 			case SerializationRecordType::PartyUpdates:
-				PartyMembers::Instance().UpdateFrom(record.second);
+				PartyMembers::Instance().UpdateFrom(state);
 				break;
 			case SerializationRecordType::Victims:
-				ActorTracker::Instance().UpdateFrom(record.second);
+				ActorTracker::Instance().UpdateFrom(state);
 				break;
 			case SerializationRecordType::Adventures:
-				AdventureTargets::Instance().UpdateFrom(record.second);
+				AdventureTargets::Instance().UpdateFrom(state);
 				break;
 			default:
 				break;
@@ -104,103 +150,203 @@ void CosaveData::SeedState()
 	}
 }
 
-bool CosaveData::Serialize(SKSE::SerializationInterface* intf)
+bool CosaveData::Compress(const uint32_t tag, const nlohmann::json& state, std::string& record, size_t& plainLength)
 {
-	// Serialize JSON and compress per https://github.com/google/brotli
-	// output LoadOrder
-	std::string record;
-	if (!CompressionUtils::EncodeBrotli(shse::LoadOrder::Instance(), record))
-	{
-		return false;
-	}
-	if (!intf->WriteRecord('LORD', 1, record.c_str(), static_cast<uint32_t>(record.length())))
-	{
-		REL_ERROR("Failed to serialize LORD");
-		return false;
-	}
-	else
-	{
-		REL_MESSAGE("Wrote LORD record {} bytes", record.length());
+	// Serialize JSON in compact binary form, streamed through compression per https://github.com/google/brotli
+	CompressionUtils::BrotliOutputBuffer compressor(record, false);
+	try {
+		CosaveCodec::Encode(state, compressor);
 	}
-	// output Collection Groups - Definitions and Members
-	if (!CompressionUtils::EncodeBrotli(shse::CollectionManager::Instance(), record))
-	{
+	catch (const std::exception& exc) {
+		REL_ERROR("Failed to encode {}:\n{}", RecordTagName(tag), exc.what());
 		return false;
 	}
-	if (!intf->WriteRecord('COLL', 1, record.c_str(), static_cast<uint32_t>(record.length())))
+	if (!compressor.Finish())
 	{
-		REL_ERROR("Failed to serialize COLL");
+		REL_ERROR("Compressing {} record {} bytes failed", RecordTagName(tag), compressor.PlainLength());
 		return false;
 	}
-	else
-	{
-		REL_MESSAGE("Wrote COLL record {} bytes", record.length());
-	}
-	// output Location history
-	if (!CompressionUtils::EncodeBrotli(shse::VisitedPlaces::Instance(), record))
-	{
+	plainLength += compressor.PlainLength();
+	return true;
+}
+
+bool CosaveData::EncodeRecord(const uint32_t tag, const nlohmann::json& state, std::string& record)
+{
+	const auto startTime(std::chrono::high_resolution_clock::now());
+	size_t plainLength(0);
+	if (!Compress(tag, state, record, plainLength))
 		return false;
-	}
-	if (!intf->WriteRecord('PLAC', 1, record.c_str(), static_cast<uint32_t>(record.length())))
-	{
-		REL_ERROR("Failed to serialize PLAC");
+	REL_MESSAGE("Encoded {} record {} bytes, compressed to {} bytes in {} microseconds", RecordTagName(tag), plainLength, record.length(),
+		std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - startTime).count());
+	return true;
+}
+
+bool CosaveData::EncodeChunk(const uint32_t tag, const nlohmann::json& state, std::string& chunk, size_t& plainLength)
+{
+	const auto startTime(std::chrono::high_resolution_clock::now());
+	const size_t before(plainLength);
+	if (!Compress(tag, state, chunk, plainLength))
 		return false;
-	}
-	else
-	{
-		REL_MESSAGE("Wrote PLAC record {} bytes", record.length());
-	}
-	// output Followers-in-Party history
-	if (!CompressionUtils::EncodeBrotli(shse::PartyMembers::Instance(), record))
+	DBG_MESSAGE("Encoded {} chunk {} bytes, compressed to {} bytes in {} microseconds", RecordTagName(tag), plainLength - before,
+		chunk.length(), std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - startTime).count());
+	return true;
+}
+
+void CosaveData::AppendChunk(std::string& record, const std::string& chunk)
+{
+	const uint32_t length(static_cast<uint32_t>(chunk.length()));
+	record.append(reinterpret_cast<const char*>(&length), sizeof(length));
+	record.append(chunk);
+}
+
+bool CosaveData::RefreshRecord(const uint32_t tag, const VisitedPlaces& subsystem, size_t& encoded)
+{
+	const uint64_t generation(subsystem.Generation());
 	{
-		return false;
+		RecursiveLockGuard guard(m_cosaveLock);
+		const auto cached(m_cachedRecords.find(tag));
+		if (cached != m_cachedRecords.cend() && cached->second.m_generation == generation)
+			return true;
 	}
-	if (!intf->WriteRecord('PRTY', 1, record.c_str(), static_cast<uint32_t>(record.length())))
-	{
-		REL_ERROR("Failed to serialize PRTY");
+	std::string record;
+	if (!subsystem.EncodeChunks(tag, record))
 		return false;
-	}
-	else
-	{
-		REL_MESSAGE("Wrote PRTY record {} bytes", record.length());
-	}
-	if (!CompressionUtils::EncodeBrotli(shse::ActorTracker::Instance(), record))
+	++encoded;
+	RecursiveLockGuard guard(m_cosaveLock);
+	const auto cached(m_cachedRecords.find(tag));
+	if (cached == m_cachedRecords.cend() || cached->second.m_generation < generation)
 	{
-		return false;
+		m_cachedRecords[tag] = { generation, ChunkedRecordVersion, std::move(record) };
 	}
-	if (!intf->WriteRecord('VCTM', 1, record.c_str(), static_cast<uint32_t>(record.length())))
+	return true;
+}
+
+bool CosaveData::WriteEncodedRecord(SKSE::SerializationInterface* intf, const uint32_t tag, const uint32_t version, const std::string& record) const
+{
+	if (!intf->WriteRecord(tag, version, record.c_str(), static_cast<uint32_t>(record.length())))
 	{
-		REL_ERROR("Failed to serialize VCTM");
+		REL_ERROR("Failed to serialize {}", RecordTagName(tag));
 		return false;
 	}
-	else
-	{
-		REL_MESSAGE("Wrote VCTM record {} bytes", record.length());
+	REL_MESSAGE("Wrote {} record version {} {} bytes", RecordTagName(tag), version, record.length());
+	return true;
+}
+
+bool CosaveData::DecodeBinaryRecord(const uint32_t tag, const std::string& record, nlohmann::json& state)
+{
+	// binary record is decoded as it is inflated
+	CompressionUtils::BrotliInputBuffer inflater(record);
+	try {
+		state = CosaveCodec::Decode(inflater, inflater.PlainLength());
 	}
-	if (!CompressionUtils::EncodeBrotli(shse::AdventureTargets::Instance(), record))
-	{
+	catch (const std::exception& exc) {
+		REL_ERROR("Failed to decode {} record:\n{}", RecordTagName(tag), exc.what());
 		return false;
 	}
-	if (!intf->WriteRecord('ADVN', 1, record.c_str(), static_cast<uint32_t>(record.length())))
+	return !inflater.Failed();
+}
+
+bool CosaveData::DecodeRecord(const uint32_t tag, const uint32_t version, const std::string& record, nlohmann::json& state)
+{
+	switch (version)
 	{
-		REL_ERROR("Failed to serialize ADVN");
+	case JSONRecordVersion:
+		return CompressionUtils::DecodeBrotli(record, state);
+	case BinaryRecordVersion:
+		return DecodeBinaryRecord(tag, record, state);
+	case ChunkedRecordVersion:
+		return DecodeChunkedRecord(tag, record, state);
+	default:
+		REL_ERROR("Unsupported {} record version {}", RecordTagName(tag), version);
 		return false;
 	}
-	else
+}
+
+template <typename F>
+bool CosaveData::DecodeChunks(const uint32_t tag, const std::string& record, F&& apply)
+{
+	size_t offset(0);
+	while (offset < record.length())
 	{
-		REL_MESSAGE("Wrote ADVN record {} bytes", record.length());
+		uint32_t length(0);
+		if (record.length() - offset < sizeof(length))
+		{
+			REL_ERROR("{} record truncated in chunk header at offset {}", RecordTagName(tag), offset);
+			return false;
+		}
+		std::copy_n(record.cbegin() + offset, sizeof(length), reinterpret_cast<char*>(&length));
+		offset += sizeof(length);
+		if (record.length() - offset < length)
+		{
+			REL_ERROR("{} record chunk of {} bytes truncated at offset {}", RecordTagName(tag), length, offset);
+			return false;
+		}
+		nlohmann::json chunk;
+		if (!DecodeBinaryRecord(tag, record.substr(offset, length), chunk))
+			return false;
+		offset += length;
+		apply(chunk);
 	}
 	return true;
 }
 
+// top-level arrays of the chunks are concatenated, for a subsystem that cannot take its state a chunk at a time
+bool CosaveData::DecodeChunkedRecord(const uint32_t tag, const std::string& record, nlohmann::json& state)
+{
+	state = nlohmann::json::object();
+	return DecodeChunks(tag, record, [&](const nlohmann::json& chunk) {
+		for (const auto& entry : chunk.items())
+		{
+			nlohmann::json& merged(state[entry.key()]);
+			if (entry.value().is_array() && (merged.is_null() || merged.is_array()))
+			{
+				for (const auto& element : entry.value())
+				{
+					merged.push_back(element);
+				}
+			}
+			else
+			{
+				merged = entry.value();
+			}
+		}
+	});
+}
+
+// runs on the cosave worker thread between saves
+void CosaveData::PreEncode()
+{
+	const auto startTime(std::chrono::high_resolution_clock::now());
+	size_t encoded(0);
+	ForEachRecord([&](const uint32_t tag, const auto& subsystem) -> bool {
+		return RefreshRecord(tag, subsystem, encoded);
+	});
+	if (encoded > 0)
+	{
+		REL_MESSAGE("Pre-encoded {} cosave records in {} microseconds", encoded,
+			std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - startTime).count());
+	}
+}
+
+bool CosaveData::Serialize(SKSE::SerializationInterface* intf)
+{
+	const auto startTime(std::chrono::high_resolution_clock::now());
+	size_t encoded(0);
+	const bool result(ForEachRecord([&](const uint32_t tag, const auto& subsystem) -> bool {
+		return WriteRecord(intf, tag, subsystem, encoded);
+	}));
+	REL_MESSAGE("Cosave written in {} microseconds, {} records encoded inline",
+		std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - startTime).count(), encoded);
+	return result;
+}
+
 bool CosaveData::Deserialize(SKSE::SerializationInterface* intf)
 {
 	uint32_t readType;
 	uint32_t version;
 	uint32_t length;
-	std::string saveData;
 	while (intf->GetNextRecordInfo(readType, version, length)) {
-		saveData.resize(length);
+		std::string saveData(length, '\0');
 		if (!intf->ReadRecordData(const_cast<char*>(saveData.c_str()), length))
 		{
 			REL_ERROR("Failed to load record {}", readType);
@@ -244,15 +390,13 @@ bool CosaveData::Deserialize(SKSE::SerializationInterface* intf)
 		}
 		if (recordType != shse::SerializationRecordType::MAX)
 		{
-			nlohmann::json record;
-			if (CompressionUtils::DecodeBrotli(saveData, record))
-			{
-				m_records.insert({ recordType, record });
-			}
-			else
+			if (version != JSONRecordVersion && version != BinaryRecordVersion && version != ChunkedRecordVersion)
 			{
-				return false;
+				REL_ERROR("Unsupported {} record version {}, skipped", RecordTagName(readType), version);
+				continue;
 			}
+			// decoded when state is seeded
+			m_records.insert({ recordType, { readType, version, std::move(saveData) } });
 		}
 	}
 	return true;
@@ -22,6 +22,8 @@ http://www.fsf.org/licensing/licenses
 namespace shse
 {
 
+class VisitedPlaces;
+
 class CosaveData {
 public:
 	static CosaveData& Instance();
@@ -29,13 +31,92 @@ public:
 	void Clear();
 	void SeedState();
 
+	void PreEncode();
 	bool Serialize(SKSE::SerializationInterface* intf);
 	bool Deserialize(SKSE::SerializationInterface* intf);
 
+	// one version 2 record body
+	static bool EncodeRecord(const uint32_t tag, const nlohmann::json& state, std::string& record);
+	// one chunk of a version 3 record, the caller logs the whole record. Adds the chunk's uncompressed size to plainLength.
+	static bool EncodeChunk(const uint32_t tag, const nlohmann::json& state, std::string& chunk, size_t& plainLength);
+	// appends a chunk to a version 3 record body
+	static void AppendChunk(std::string& record, const std::string& chunk);
+	static std::string RecordTagName(const uint32_t tag);
+
 private:
+	// version 1 is brotli-compressed JSON text, version 2 is brotli-compressed CosaveCodec binary. Version 3 is a
+	// sequence of length-prefixed version 2 bodies, whose top-level arrays are concatenated on load.
+	static constexpr uint32_t JSONRecordVersion = 1;
+	static constexpr uint32_t BinaryRecordVersion = 2;
+	static constexpr uint32_t ChunkedRecordVersion = 3;
+
+	// Encoded records are cached with the subsystem generation they were built from, refreshed by PreEncode between
+	// saves. Stale records are encoded inline at save. The generation is read before state is captured, so a
+	// concurrent change costs at most a redundant re-encode later.
+	template <typename T>
+	bool RefreshRecord(const uint32_t tag, const T& subsystem, size_t& encoded)
+	{
+		const uint64_t generation(subsystem.Generation());
+		{
+			RecursiveLockGuard guard(m_cosaveLock);
+			const auto cached(m_cachedRecords.find(tag));
+			if (cached != m_cachedRecords.cend() && cached->second.m_generation == generation)
+				return true;
+		}
+		// snapshot and encode without the cosave lock, so background encoding never blocks a save
+		std::string record;
+		if (!EncodeRecord(tag, nlohmann::json(subsystem), record))
+			return false;
+		++encoded;
+		RecursiveLockGuard guard(m_cosaveLock);
+		const auto cached(m_cachedRecords.find(tag));
+		// a concurrent encode may already have stored a later snapshot
+		if (cached == m_cachedRecords.cend() || cached->second.m_generation < generation)
+		{
+			m_cachedRecords[tag] = { generation, BinaryRecordVersion, std::move(record) };
+		}
+		return true;
+	}
+	// Visited Places history is append-only by game day: sealed days reuse their encoded chunk, so a save only
+	// encodes the open day
+	bool RefreshRecord(const uint32_t tag, const VisitedPlaces& subsystem, size_t& encoded);
+	template <typename T>
+	bool WriteRecord(SKSE::SerializationInterface* intf, const uint32_t tag, const T& subsystem, size_t& encoded)
+	{
+		if (!RefreshRecord(tag, subsystem, encoded))
+			return false;
+		RecursiveLockGuard guard(m_cosaveLock);
+		const CachedRecord& cached(m_cachedRecords[tag]);
+		return WriteEncodedRecord(intf, tag, cached.m_version, cached.m_record);
+	}
+	static bool Compress(const uint32_t tag, const nlohmann::json& state, std::string& record, size_t& plainLength);
+	bool WriteEncodedRecord(SKSE::SerializationInterface* intf, const uint32_t tag, const uint32_t version, const std::string& record) const;
+	static bool DecodeRecord(const uint32_t tag, const uint32_t version, const std::string& record, nlohmann::json& state);
+	static bool DecodeBinaryRecord(const uint32_t tag, const std::string& record, nlohmann::json& state);
+	// decodes one chunk of a version 3 record at a time and passes it to apply
+	template <typename F>
+	static bool DecodeChunks(const uint32_t tag, const std::string& record, F&& apply);
+	static bool DecodeChunkedRecord(const uint32_t tag, const std::string& record, nlohmann::json& state);
+
+	struct CachedRecord
+	{
+		uint64_t m_generation = 0;
+		uint32_t m_version = BinaryRecordVersion;
+		std::string m_record;
+	};
+
+	// Records are kept as read and decoded one at a time when state is seeded, so at most one record's JSON is held
+	struct LoadedRecord
+	{
+		uint32_t m_tag;
+		uint32_t m_version;
+		std::string m_record;
+	};
+
 	static std::unique_ptr<CosaveData> m_instance;
 	mutable RecursiveLock m_cosaveLock;
-	std::map<shse::SerializationRecordType, nlohmann::json> m_records;
+	std::map<shse::SerializationRecordType, LoadedRecord> m_records;
+	std::unordered_map<uint32_t, CachedRecord> m_cachedRecords;
 };
 
 }
@@ -0,0 +1,132 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#include "PrecompiledHeaders.h"
+
+#include "Data/KeywordIndex.h"
+#include "Utilities/utils.h"
+
+namespace shse
+{
+
+std::unique_ptr<KeywordIndex> KeywordIndex::m_instance;
+
+KeywordIndex& KeywordIndex::Instance()
+{
+	if (!m_instance)
+	{
+		m_instance = std::make_unique<KeywordIndex>();
+	}
+	return *m_instance;
+}
+
+KeywordIndex::KeywordIndex()
+{
+}
+
+size_t KeywordIndex::Register(const RE::BGSKeyword* keyword)
+{
+	const auto registered(m_rows.Register(keyword));
+	if (registered.second)
+	{
+		DBG_VMESSAGE("KYWD {}/0x{:08x} indexed as bit {}", FormUtils::SafeGetFormEditorID(keyword), keyword->GetFormID(),
+			registered.first);
+	}
+	return registered.first;
+}
+
+void KeywordIndex::Register(const RE::BGSKeyword* keyword, KeywordMask& mask)
+{
+	mask.Add(Register(keyword));
+}
+
+void KeywordIndex::IndexForms()
+{
+	if (m_rows.IsCurrent())
+	{
+		DBG_MESSAGE("Form Keyword index up to date for {} KYWDs", m_rows.Registered());
+		return;
+	}
+#ifdef _PROFILING
+	WindowsUtils::ScopedTimer elapsed("Index Form Keywords");
+#endif
+	m_rows.Reset();
+
+	// Collectible item types, plus RACE for NPC filtering
+	IndexFormArray<RE::AlchemyItem>();
+	IndexFormArray<RE::TESAmmo>();
+	IndexFormArray<RE::TESObjectARMO>();
+	IndexFormArray<RE::TESObjectBOOK>();
+	IndexFormArray<RE::IngredientItem>();
+	IndexFormArray<RE::TESKey>();
+	IndexFormArray<RE::TESObjectMISC>();
+	IndexFormArray<RE::TESSoulGem>();
+	IndexFormArray<RE::TESObjectWEAP>();
+	IndexFormArray<RE::TESRace>();
+
+	REL_MESSAGE("{} KYWDs indexed for {} forms, {} bytes", m_rows.Registered(), m_rows.IndexedForms(), m_rows.Bytes());
+}
+
+namespace
+{
+
+// visits each keyword of the form, for KeywordRows
+auto KeywordsOf(const RE::BGSKeywordForm* keywordForm)
+{
+	return [=](auto&& visit) {
+		for (uint32_t index = 0; index < keywordForm->GetNumKeywords(); ++index)
+		{
+			std::optional<RE::BGSKeyword*> keyword(keywordForm->GetKeywordAt(index));
+			if (keyword.has_value())
+			{
+				visit(keyword.value());
+			}
+		}
+	};
+}
+
+}
+
+void KeywordIndex::IndexForm(const RE::TESForm* form, const RE::BGSKeywordForm* keywordForm)
+{
+	if (!keywordForm || keywordForm->GetNumKeywords() == 0)
+		return;
+	m_rows.IndexForm(form, KeywordsOf(keywordForm));
+}
+
+bool KeywordIndex::HasAny(const RE::TESForm* form, const KeywordMask& mask) const
+{
+	if (!form || mask.Empty())
+		return false;
+	bool hasAny(false);
+	if (m_rows.DeterminesMatch(form, mask, hasAny))
+		return hasAny;
+	// A load-order form of an indexed type with no row has no keywords of interest. Dynamic forms are created after
+	// the index was built, so they never have a row.
+	if (m_rows.IsCurrent() && !form->IsDynamicForm() && m_indexedFormTypes.contains(form->GetFormType()))
+		return false;
+
+	// form not covered by the index, resolve the row on the fly
+	const RE::BGSKeywordForm* keywordForm(form->As<RE::BGSKeywordForm>());
+	if (!keywordForm)
+		return false;
+	return m_rows.HasAnyUnindexed(KeywordsOf(keywordForm), mask);
+}
+
+}
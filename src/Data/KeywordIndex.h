@@ -0,0 +1,68 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#pragma once
+
+#include "Data/KeywordMask.h"
+#include "Data/KeywordRows.h"
+
+namespace shse
+{
+
+// Keywords of interest to the plugin (Collections, glowable books, category mappings, NPC filter) are assigned compact
+// bit indices as they are registered during data load. Every keyword-bearing form of an indexed type then gets a
+// precomputed row of bits, so a keyword predicate is a bitwise AND instead of a walk of BGSKeywordForm with
+// per-keyword hash lookups.
+class KeywordIndex
+{
+public:
+	static KeywordIndex& Instance();
+	KeywordIndex();
+
+	size_t Register(const RE::BGSKeyword* keyword);
+	void Register(const RE::BGSKeyword* keyword, KeywordMask& mask);
+	// (re)build per-form rows if keywords were registered since the last build - game data load only
+	void IndexForms();
+	// forms outside the index - unindexed types, dynamic forms, or keywords registered since the build - are
+	// resolved by walking their keywords
+	bool HasAny(const RE::TESForm* form, const KeywordMask& mask) const;
+
+private:
+	template <typename T>
+	void IndexFormArray()
+	{
+		RE::TESDataHandler* dhnd = RE::TESDataHandler::GetSingleton();
+		if (!dhnd)
+			return;
+		m_indexedFormTypes.insert(T::FORMTYPE);
+		for (const T* typedForm : dhnd->GetFormArray<T>())
+		{
+			IndexForm(typedForm, typedForm->As<RE::BGSKeywordForm>());
+		}
+	}
+	void IndexForm(const RE::TESForm* form, const RE::BGSKeywordForm* keywordForm);
+
+	static std::unique_ptr<KeywordIndex> m_instance;
+
+	// no lock - registration and indexing happen during game data load, thereafter read-only
+	KeywordRows<const RE::BGSKeyword*, const RE::TESForm*> m_rows;
+	std::unordered_set<RE::FormType> m_indexedFormTypes;
+};
+
+}
@@ -0,0 +1,53 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#include "Data/KeywordMask.h"
+
+#include <algorithm>
+
+namespace shse
+{
+
+KeywordMask::KeywordMask()
+{
+}
+
+void KeywordMask::Add(const size_t bit)
+{
+	const size_t word(bit / WordBits);
+	if (word >= m_words.size())
+	{
+		m_words.resize(word + 1, 0);
+	}
+	m_words[word] |= uint64_t(1) << (bit % WordBits);
+}
+
+bool KeywordMask::Intersects(const uint64_t* row, const size_t rowWords) const
+{
+	// mask may be narrower than rows built after later keyword registrations, and vice versa
+	const size_t words(std::min(rowWords, m_words.size()));
+	for (size_t word = 0; word < words; ++word)
+	{
+		if (row[word] & m_words[word])
+			return true;
+	}
+	return false;
+}
+
+}
@@ -0,0 +1,44 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace shse
+{
+
+// Set of keyword bit indices allocated by KeywordIndex. Bits are stable once allocated, so a mask built early in
+// data load remains valid after later registrations widen the per-form rows.
+class KeywordMask
+{
+public:
+	KeywordMask();
+	void Add(const size_t bit);
+	inline bool Empty() const { return m_words.empty(); }
+	bool Intersects(const uint64_t* row, const size_t rowWords) const;
+
+private:
+	static constexpr size_t WordBits = 64;
+	std::vector<uint64_t> m_words;
+};
+
+}
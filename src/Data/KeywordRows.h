@@ -0,0 +1,128 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Data/KeywordMask.h"
+
+namespace shse
+{
+
+// Keyword bit allocation and packed per-form keyword rows for KeywordIndex, free of game types so the row logic can be
+// exercised outside the game. A form's keywords are supplied as a callable that passes each keyword to a visitor.
+template <typename KEYWORD, typename FORM>
+class KeywordRows
+{
+public:
+	KeywordRows() : m_indexedKeywords(0), m_rowWords(0)
+	{
+	}
+
+	// returns the keyword's bit and whether it was newly allocated
+	std::pair<size_t, bool> Register(const KEYWORD keyword)
+	{
+		const auto inserted(m_bitByKeyword.insert({ keyword, m_bitByKeyword.size() }));
+		return { inserted.first->second, inserted.second };
+	}
+	inline size_t Registered() const { return m_bitByKeyword.size(); }
+	// rows are complete only for keywords registered before the last Reset
+	inline bool IsCurrent() const { return m_indexedKeywords == m_bitByKeyword.size(); }
+	inline size_t IndexedForms() const { return m_rowOffsetByForm.size(); }
+	inline size_t Bytes() const { return m_rows.size() * sizeof(uint64_t); }
+
+	// discard all rows, sizing new ones for every keyword registered so far
+	void Reset()
+	{
+		m_indexedKeywords = m_bitByKeyword.size();
+		m_rowWords = WordsFor(m_indexedKeywords);
+		m_rowOffsetByForm.clear();
+		m_rows.clear();
+	}
+
+	template <typename KEYWORDS>
+	void IndexForm(const FORM form, KEYWORDS&& keywords)
+	{
+		const size_t offset(m_rows.size());
+		m_rows.resize(offset + m_rowWords, 0);
+		if (BuildRow(keywords, &m_rows[offset]))
+		{
+			m_rowOffsetByForm.insert({ form, offset });
+		}
+		else
+		{
+			// no keywords of interest, reclaim the row
+			m_rows.resize(offset);
+		}
+	}
+
+	// returns true and sets hasAny if the form has a current row
+	bool DeterminesMatch(const FORM form, const KeywordMask& mask, bool& hasAny) const
+	{
+		if (!IsCurrent())
+			return false;
+		const auto row(m_rowOffsetByForm.find(form));
+		if (row == m_rowOffsetByForm.cend())
+			return false;
+		hasAny = mask.Intersects(&m_rows[row->second], m_rowWords);
+		return true;
+	}
+
+	// row for a form outside the index, built in a buffer reused by each thread
+	template <typename KEYWORDS>
+	bool HasAnyUnindexed(KEYWORDS&& keywords, const KeywordMask& mask) const
+	{
+		thread_local std::vector<uint64_t> adhocRow;
+		const size_t words(WordsFor(m_bitByKeyword.size()));
+		adhocRow.assign(words, 0);
+		return BuildRow(keywords, adhocRow.data()) && mask.Intersects(adhocRow.data(), words);
+	}
+
+private:
+	static constexpr size_t WordBits = 64;
+
+	static inline size_t WordsFor(const size_t keywords) { return (keywords + WordBits - 1) / WordBits; }
+
+	template <typename KEYWORDS>
+	bool BuildRow(KEYWORDS& keywords, uint64_t* row) const
+	{
+		bool anySet(false);
+		keywords([&](const KEYWORD keyword) {
+			const auto matched(m_bitByKeyword.find(keyword));
+			if (matched == m_bitByKeyword.cend())
+				return;
+			row[matched->second / WordBits] |= uint64_t(1) << (matched->second % WordBits);
+			anySet = true;
+		});
+		return anySet;
+	}
+
+	std::unordered_map<KEYWORD, size_t> m_bitByKeyword;
+	size_t m_indexedKeywords;
+	size_t m_rowWords;
+	// forms with no registered keywords have no row, all rows are packed into one allocation
+	std::unordered_map<FORM, size_t> m_rowOffsetByForm;
+	std::vector<uint64_t> m_rows;
+};
+
+}
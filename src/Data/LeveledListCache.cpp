@@ -0,0 +1,130 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#include "PrecompiledHeaders.h"
+
+#include "Data/LeveledListCache.h"
+#include "Data/dataCase.h"
+
+namespace shse
+{
+
+std::unique_ptr<LeveledListCache> LeveledListCache::m_instance;
+
+LeveledListCache& LeveledListCache::Instance()
+{
+	if (!m_instance)
+	{
+		m_instance = std::make_unique<LeveledListCache>();
+	}
+	return *m_instance;
+}
+
+LeveledListCache::LeveledListCache()
+{
+}
+
+const LeveledListCache::Leaves& LeveledListCache::GetLeaves(const RE::TESLevItem* leveledItem)
+{
+	const auto cached(m_leavesByList.find(leveledItem));
+	if (cached != m_leavesByList.cend())
+		return cached->second;
+	Leaves leaves;
+	Flatten(leveledItem, 0, leaves);
+	return m_leavesByList.insert({ leveledItem, std::move(leaves) }).first->second;
+}
+
+void LeveledListCache::Release()
+{
+	size_t leafCount(0);
+	for (const auto& leaves : m_leavesByList)
+	{
+		leafCount += leaves.second.size();
+	}
+	REL_MESSAGE("Release {} flattened LVLIs with {} leaves", m_leavesByList.size(), leafCount);
+	m_leavesByList.clear();
+}
+
+// Returns the depth of the shallowest in-progress LVLI reached from this one. If that is above this LVLI, a cycle
+// was cut short and the leaves are only valid within the enclosing walk, so they are not cached.
+size_t LeveledListCache::Flatten(const RE::TESLevItem* leveledItem, const size_t depth, Leaves& leaves)
+{
+	m_inProgress.insert({ leveledItem, depth });
+	std::unordered_set<const RE::TESBoundObject*> leavesSeen;
+	size_t cycleDepth(NotInCycle);
+	for (const RE::LEVELED_OBJECT& leveledObject : leveledItem->entries)
+	{
+		RE::TESForm* itemForm(leveledObject.form);
+		if (!itemForm)
+			continue;
+		// Handle nesting of leveled items
+		const RE::TESLevItem* nestedItem(itemForm->As<RE::TESLevItem>());
+		if (nestedItem)
+		{
+			const auto inProgress(m_inProgress.find(nestedItem));
+			if (inProgress != m_inProgress.cend())
+			{
+				cycleDepth = std::min(cycleDepth, inProgress->second);
+				continue;
+			}
+			const auto cached(m_leavesByList.find(nestedItem));
+			if (cached != m_leavesByList.cend())
+			{
+				for (RE::TESBoundObject* leaf : cached->second)
+				{
+					if (leavesSeen.insert(leaf).second)
+						leaves.push_back(leaf);
+				}
+				continue;
+			}
+			Leaves nestedLeaves;
+			const size_t nestedCycleDepth(Flatten(nestedItem, depth + 1, nestedLeaves));
+			for (RE::TESBoundObject* leaf : nestedLeaves)
+			{
+				if (leavesSeen.insert(leaf).second)
+					leaves.push_back(leaf);
+			}
+			if (nestedCycleDepth > depth)
+			{
+				m_leavesByList.insert({ nestedItem, std::move(nestedLeaves) });
+			}
+			else
+			{
+				cycleDepth = std::min(cycleDepth, nestedCycleDepth);
+			}
+			continue;
+		}
+		RE::TESBoundObject* boundItem(itemForm->As<RE::TESBoundObject>());
+		if (!boundItem)
+		{
+			if (DataCase::GetInstance()->GetObjectTypeForForm(itemForm) != ObjectType::unknown)
+			{
+				REL_WARNING("LVLI 0x{:08x} has content leaf {}/0x{:08x} that is not TESBoundObject", leveledItem->GetFormID(),
+					itemForm->GetName(), itemForm->GetFormID());
+			}
+			continue;
+		}
+		if (leavesSeen.insert(boundItem).second)
+			leaves.push_back(boundItem);
+	}
+	m_inProgress.erase(leveledItem);
+	return cycleDepth >= depth ? NotInCycle : cycleDepth;
+}
+
+}
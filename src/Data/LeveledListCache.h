@@ -0,0 +1,53 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#pragma once
+
+namespace shse
+{
+
+// Flattened contents of TESLevItem trees. Each LVLI is walked once into a deduplicated leaf list in depth-first order,
+// and nested LVLIs reuse the cached list of any sub-list already flattened, so overlapping subtrees are not re-walked
+// by each consumer. Leaf ObjectType is not cached, because produce categorization can retype leaves while the cache
+// is in use.
+class LeveledListCache
+{
+public:
+	typedef std::vector<RE::TESBoundObject*> Leaves;
+
+	static LeveledListCache& Instance();
+	LeveledListCache();
+
+	const Leaves& GetLeaves(const RE::TESLevItem* leveledItem);
+	// game data load consumers are done with the cache
+	void Release();
+
+private:
+	static constexpr size_t NotInCycle = std::numeric_limits<size_t>::max();
+	size_t Flatten(const RE::TESLevItem* leveledItem, const size_t depth, Leaves& leaves);
+
+	static std::unique_ptr<LeveledListCache> m_instance;
+
+	// no lock - only used during game data load
+	std::unordered_map<const RE::TESLevItem*, Leaves> m_leavesByList;
+	// walk depth of each LVLI currently being flattened, to stop cycles
+	std::unordered_map<const RE::TESLevItem*, size_t> m_inProgress;
+};
+
+}
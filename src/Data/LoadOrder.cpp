@@ -78,6 +78,7 @@ bool LoadOrder::Analyze(void)
 		REL_MESSAGE("{} has FormID mask 0x{:08x}, priority {}", modFile->fileName, formIDMask, priority);
 		++priority;
 	}
+	++m_generation;
 	return true;
 }
 
@@ -19,6 +19,8 @@ http://www.fsf.org/licensing/licenses
 *************************************************************************/
 #pragma once
 
+#include <atomic>
+
 constexpr RE::FormID ESPMask = 0xFF000000;
 constexpr RE::FormID FullRawMask = 0x00FFFFFF;
 constexpr RE::FormID ESPFETypeMask = 0xFE000000;
@@ -41,6 +43,8 @@ public:
 	bool ModOwnsForm(const std::string& modName, const RE::FormID formID) const;
 	void AsJSON(nlohmann::json& j) const;
 	void UpdateFrom(const nlohmann::json& j);
+	// advances whenever state saved to the cosave changes
+	inline uint64_t Generation() const { return m_generation; }
 	RE::TESForm* RehydrateCosaveForm(const RE::FormID cosaveID) const;
 	template <typename T>
 	T* RehydrateCosaveFormAs(const RE::FormID cosaveID) const
@@ -83,6 +87,7 @@ private:
 	// no lock as all public functions are const once loaded
 	static std::unique_ptr<LoadOrder> m_instance;
 	mutable RecursiveLock m_loadLock;
+	std::atomic<uint64_t> m_generation = 0;
 
 	std::unordered_map<std::string, LoadInfo> m_loadInfoByName;
 	std::unordered_map<std::string, LoadInfo> m_cosaveLoadInfoByName;
@@ -87,6 +87,8 @@ void SettingsCache::Refresh(void)
 	REL_VMESSAGE("Collections Enabled {}", m_collectionsEnabled);
 	m_notifyLocationChange = ini->GetSetting(INIFile::PrimaryType::common, INIFile::SecondaryType::config, "NotifyLocationChange") != 0.0;
 	REL_VMESSAGE("Notify Player of Location Change {}", m_notifyLocationChange);
+	m_compactVisitedPlaces = ini->GetSetting(INIFile::PrimaryType::common, INIFile::SecondaryType::config, "CompactVisitedPlaces") != 0.0;
+	REL_VMESSAGE("Compact Visited Places history {}", m_compactVisitedPlaces);
 
 	m_valuableItemThreshold = ini->GetSetting(INIFile::PrimaryType::harvest, INIFile::SecondaryType::config, "ValuableItemThreshold");
 	REL_VMESSAGE("Valuable Item Threshold {:0.2f}", m_valuableItemThreshold);
@@ -188,6 +190,7 @@ void SettingsCache::Refresh(void)
 	REL_VMESSAGE("Prevent Population Center Looting {}", m_preventPopulationCenterLooting);
 	m_maxMiningItems = static_cast<int16_t>(ini->GetSetting(INIFile::PrimaryType::harvest, INIFile::SecondaryType::config, "MaxMiningItems"));
 	REL_VMESSAGE("Max Mining Items {}", m_maxMiningItems);
+	++m_generation;
 }
 
 double SettingsCache::OutdoorsRadius() const
@@ -257,6 +260,11 @@ bool SettingsCache::NotifyLocationChange() const
 {
 	return m_notifyLocationChange;
 }
+
+bool SettingsCache::CompactVisitedPlaces() const
+{
+	return m_compactVisitedPlaces;
+}
 double SettingsCache::ValuableItemThreshold() const
 {
 	return m_valuableItemThreshold;
@@ -19,6 +19,8 @@ http://www.fsf.org/licensing/licenses
 *************************************************************************/
 #pragma once
 
+#include <atomic>
+
 #include "WorldState/PopulationCenters.h"
 
 namespace shse
@@ -29,6 +31,8 @@ public:
 	static SettingsCache& Instance();
 	SettingsCache();
 	void Refresh(void);
+	// advances whenever settings are recached
+	inline uint64_t Generation() const { return m_generation; }
 
 	double OutdoorsRadius() const;
 	double IndoorsRadius() const;
@@ -47,6 +51,7 @@ public:
 	bool FortuneHuntContainer() const;
 	bool CollectionsEnabled() const;
 	bool NotifyLocationChange() const;
+	bool CompactVisitedPlaces() const;
 
 	double ValuableItemThreshold() const;
 	double ValueWeightDefault() const;
@@ -85,6 +90,7 @@ public:
 
 private:
 	static std::unique_ptr<SettingsCache> m_instance;
+	std::atomic<uint64_t> m_generation = 0;
 	double m_outdoorsRadius;
 	double m_indoorsRadius;
 	double m_verticalFactor;
@@ -101,6 +107,7 @@ private:
 	bool m_fortuneHuntContainer;
 	bool m_collectionsEnabled;
 	bool m_notifyLocationChange;
+	bool m_compactVisitedPlaces;
 	double m_valuableItemThreshold;
 	double m_valueWeightDefault;
 	DeadBodyLooting m_deadBodyLooting;
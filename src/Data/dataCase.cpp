@@ -25,6 +25,7 @@ http://www.fsf.org/licensing/licenses
 #include <sstream>
 
 #include "Data/dataCase.h"
+#include "Data/LeveledListCache.h"
 #include "Data/LoadOrder.h"
 #include "Utilities/utils.h"
 #include "Utilities/version.h"
@@ -139,11 +140,11 @@ void DataCase::GetTranslationData()
 		std::string keyS = StringUtils::FromUnicode(key);
 		std::string translationS = StringUtils::FromUnicode(translation);
 
-		m_translations[keyS] = translationS;
+		m_translations[m_vocabulary.Intern(keyS)] = m_vocabulary.Intern(translationS);
 		DBG_VMESSAGE("Translation entry: {} -> {}", keyS.c_str(), translationS.c_str());
 
 	}
-	DBG_MESSAGE("* TranslationData({})", m_translations.size());
+	DBG_MESSAGE("* TranslationData({}), {} unique strings", m_translations.size(), m_vocabulary.Size());
 
 	return;
 }
@@ -151,21 +152,30 @@ void DataCase::GetTranslationData()
 // process comma-separated list of allowed ACTI verbs, to make localization INI-based
 void DataCase::ActivationVerbsByType(const char* activationVerbKey, const ObjectType objectType)
 {
-	RE::BSString iniVerbs(GetTranslation(activationVerbKey));
-	std::istringstream verbStream(iniVerbs.c_str());
-	std::string nextVerb;
-	while (std::getline(verbStream, nextVerb, ',')) {
-		auto inserted(m_objectTypeByActivationVerb.insert(std::make_pair(nextVerb, objectType)));
+	const char* iniVerbs(GetTranslation(activationVerbKey));
+	if (!iniVerbs)
+	{
+		REL_WARNING("No Activation verbs for {}", activationVerbKey);
+		return;
+	}
+	// verbs are views into the translation value, which is already interned
+	std::string_view verbs(iniVerbs);
+	while (!verbs.empty())
+	{
+		const size_t separator(verbs.find(','));
+		const std::string_view nextVerb(verbs.substr(0, separator));
+		verbs = separator == std::string_view::npos ? std::string_view() : verbs.substr(separator + 1);
+		auto inserted(m_objectTypeByActivationVerb.insert(std::make_pair(m_vocabulary.Intern(nextVerb), objectType)));
 		if (inserted.second)
 		{
 			REL_MESSAGE("Activation Verb {}/{} registered as ObjectType {}",
-				activationVerbKey, nextVerb.c_str(), GetObjectTypeName(objectType).c_str());
+				activationVerbKey, nextVerb, GetObjectTypeName(objectType).c_str());
 		}
 		else
 		{
 			// dup verb in Translation file
 			REL_WARNING("Ignoring Activation verb {}/{} already registered as ObjectType {}",
-				activationVerbKey, nextVerb.c_str(), GetObjectTypeName(inserted.first->second).c_str());
+				activationVerbKey, nextVerb, GetObjectTypeName(inserted.first->second).c_str());
 		}
 	}
 }
@@ -187,7 +197,7 @@ void DataCase::StoreActivationVerbs()
 
 ObjectType DataCase::GetObjectTypeForActivationText(const RE::BSString& activationText) const
 {
-	std::string verb(GetVerbFromActivationText(activationText));
+	const std::string_view verb(GetVerbFromActivationText(activationText));
 	const auto verbMatched(m_objectTypeByActivationVerb.find(verb));
 	if (verbMatched != m_objectTypeByActivationVerb.cend())
 	{
@@ -195,7 +205,11 @@ ObjectType DataCase::GetObjectTypeForActivationText(const RE::BSString& activati
 	}
 	else
 	{
-		m_unhandledActivationVerbs.insert(verb);
+		// allocate only on the first miss for each verb
+		if (!m_unhandledActivationVerbs.contains(verb))
+		{
+			m_unhandledActivationVerbs.emplace(verb);
+		}
 		return ObjectType::unknown;
 	}
 }
@@ -209,7 +223,7 @@ void DataCase::CategorizeByActivationVerb()
 	{
 		if (!activator->GetFullNameLength())
 			continue;
-		const char* formName(activator->GetFullName());
+		const std::string_view formName(activator->GetFullName());
 		DBG_VMESSAGE("Categorizing {}/0x{:08x} by activation verb", formName, activator->GetFormID());
 
 		RE::BSString activationText;
@@ -225,12 +239,12 @@ void DataCase::CategorizeByActivationVerb()
 					{
 						// Deposit -> volcanic
 						ResourceType resourceType;
-						if (std::string(formName).find(std::string("Heart Stone Deposit")) != std::string::npos ||	// Dragonborn
-							std::string(formName).find(std::string("Sulfur Deposit")) != std::string::npos)			// CACO
+						if (formName.find("Heart Stone Deposit") != std::string_view::npos ||	// Dragonborn
+							formName.find("Sulfur Deposit") != std::string_view::npos)			// CACO
 						{
 							resourceType = ResourceType::volcanic;
 						}
-						else if (std::string(formName).find(std::string("Geode")) != std::string::npos)
+						else if (formName.find("Geode") != std::string_view::npos)
 						{
 							resourceType = ResourceType::geode;
 						}
@@ -245,7 +259,7 @@ void DataCase::CategorizeByActivationVerb()
 				continue;
 			}
 		}
-		DBG_MESSAGE("{}/0x{:08x} not mappable, uses verb '{}'", formName, activator->GetFormID(), GetVerbFromActivationText(activationText).c_str());
+		DBG_MESSAGE("{}/0x{:08x} not mappable, uses verb '{}'", formName, activator->GetFormID(), GetVerbFromActivationText(activationText));
 	}
 }
 
@@ -1013,10 +1027,13 @@ ResourceType DataCase::OreVeinResourceType(const RE::TESObjectACTI* mineable) co
 
 const char* DataCase::GetTranslation(const char* key) const
 {
-	const auto& translation(m_translations.find(key));
+	if (!key)
+		return nullptr;
+	const auto translation(m_translations.find(std::string_view(key)));
 	if (translation == m_translations.cend())
 		return nullptr;
-	return translation->second.c_str();
+	// interned values are null-terminated
+	return translation->second.data();
 }
 
 const RE::TESBoundObject* DataCase::ConvertIfLeveledItem(const RE::TESBoundObject* form) const
@@ -1108,6 +1125,9 @@ void DataCase::CategorizeLootables()
 	REL_MESSAGE("*** LOAD *** Set Object Type By Keywords");
 	SetObjectTypeByKeywords();
 
+	REL_MESSAGE("*** LOAD *** Index Form Keywords");
+	KeywordIndex::Instance().IndexForms();
+
 	// consumable item categorization is useful for Activator, Flora, Tree and direct access
 	REL_MESSAGE("*** LOAD *** Categorize Consumable: ALCH");
 	CategorizeConsumables<RE::AlchemyItem>();
@@ -1305,7 +1325,7 @@ void DataCase::SetObjectTypeByKeywords()
 		if (glowableBooks.find(keywordName) != glowableBooks.cend())
 		{
 			REL_VMESSAGE("Found Glowable Book KYWD {}/0x{:08x}", keywordName, keywordDef->GetFormID());
-			m_glowableBookKeywords.insert(keywordDef->GetFormID());
+			KeywordIndex::Instance().Register(keywordDef, m_glowableBookKeywords);
 		}
 
 		ObjectType objectType(ObjectType::unknown);
@@ -1333,6 +1353,7 @@ void DataCase::SetObjectTypeByKeywords()
 			continue;
 		}
 		SetObjectTypeForForm(keywordDef, DecorateIfEnchanted(keywordDef, objectType));
+		KeywordIndex::Instance().Register(keywordDef, m_objectTypeKeywords);
 	}
 }
 
@@ -1510,50 +1531,24 @@ ObjectType DataCase::DefaultIngredientObjectType(const RE::TESObjectTREE*)
 	return ObjectType::food;
 }
 
-void LeveledItemCategorizer::CategorizeContents()
-{
-	ProcessContentsAtLevel(m_rootItem);
-}
-
 LeveledItemCategorizer::LeveledItemCategorizer(const RE::TESLevItem* rootItem) :
 	m_rootItem(rootItem)
 {
-	m_lvliSeen.insert(m_rootItem);
 }
 
 LeveledItemCategorizer::~LeveledItemCategorizer()
 {
 }
 
-void LeveledItemCategorizer::ProcessContentsAtLevel(const RE::TESLevItem* leveledItem)
+void LeveledItemCategorizer::CategorizeContents()
 {
-	for (const RE::LEVELED_OBJECT& leveledObject : leveledItem->entries)
+	for (RE::TESBoundObject* leaf : LeveledListCache::Instance().GetLeaves(m_rootItem))
 	{
-		RE::TESForm* itemForm(leveledObject.form);
-		if (!itemForm)
-			continue;
-		// Handle nesting of leveled items
-		RE::TESLevItem* leveledItemForm(itemForm->As<RE::TESLevItem>());
-		if (leveledItemForm)
-		{
-			// only process LVLI if not already seen
-			if (m_lvliSeen.insert(leveledItemForm).second)
-			{
-				ProcessContentsAtLevel(leveledItemForm);
-			}
-			continue;
-		}
-		ObjectType itemType(DataCase::GetInstance()->GetObjectTypeForForm(itemForm));
+		// resolve type at point of use, leaf may have been retyped since the LVLI was flattened
+		ObjectType itemType(DataCase::GetInstance()->GetObjectTypeForForm(leaf));
 		if (itemType != ObjectType::unknown)
 		{
-			RE::TESBoundObject* boundItem = itemForm->As<RE::TESBoundObject>();
-			if (!boundItem)
-			{
-				REL_WARNING("LVLI 0x{:08x} has content leaf {}/0x{:08x} that is not TESBoundObject", m_rootItem->GetFormID(),
-					itemForm->GetName(), itemForm->GetFormID());
-				return;
-			}
-			ProcessContentLeaf(boundItem, itemType);
+			ProcessContentLeaf(leaf, itemType);
 		}
 	}
 }
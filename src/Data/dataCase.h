@@ -22,12 +22,14 @@ http://www.fsf.org/licensing/licenses
 #include <mutex>
 #include <chrono>
 
+#include "Data/KeywordIndex.h"
 #include "Looting/ProducerLootables.h"
 #include "Looting/objects.h"
 
 namespace shse
 {
 
+// Visits categorized leaves of the LVLI tree, flattened once and shared via LeveledListCache
 class LeveledItemCategorizer
 {
 public:
@@ -35,15 +37,10 @@ public:
 	virtual ~LeveledItemCategorizer();
 	void CategorizeContents();
 
-private:
-	void ProcessContentsAtLevel(const RE::TESLevItem* leveledItem);
-
 protected:
 	virtual void ProcessContentLeaf(RE::TESBoundObject* itemForm, ObjectType itemType) = 0;
 
 	const RE::TESLevItem* m_rootItem;
-	// prevent infinite recursion
-	std::unordered_set<const RE::TESLevItem*> m_lvliSeen;
 };
 
 class DataCase
@@ -101,9 +98,9 @@ public:
 	void ListsClear(const bool gameReload);
 	bool SkipAmmoLooting(RE::TESObjectREFR* refr);
 
-	inline bool IsBookGlowableKeyword(RE::BGSKeyword* keyword) const
+	inline bool IsBookGlowable(const RE::TESForm* form) const
 	{
-		return keyword && m_glowableBookKeywords.find(keyword->GetFormID()) != m_glowableBookKeywords.cend();
+		return KeywordIndex::Instance().HasAny(form, m_glowableBookKeywords);
 	}
 
 	bool PerksAddLeveledItemsOnDeath(const RE::Actor* actor) const;
@@ -146,7 +143,9 @@ public:
 	static constexpr RE::FormID RollOfPaper = 0x33761;
 
 private:
-	std::unordered_map<std::string, std::string> m_translations;
+	// backing store for translation keys/values and activation verbs, all of which are fixed once loaded
+	StringUtils::InternedStrings m_vocabulary;
+	std::unordered_map<std::string_view, std::string_view> m_translations;
 
 	std::unordered_map<const RE::TESObjectREFR*, RE::NiPoint3> m_arrowCheck;
 
@@ -164,7 +163,12 @@ private:
 	std::unordered_map<RE::FormID, ObjectType> m_objectTypeByForm;
 	mutable std::unordered_map<RE::FormID, bool> m_ingredientEffectsKnown;
 	std::unordered_map<const RE::TESProduceForm*, const RE::TESBoundObject*> m_produceFormContents;
-	std::unordered_set<RE::FormID> m_glowableBookKeywords;
+	// keys view the game's name storage, which is stable once game data is loaded
+	typedef std::unordered_multimap<std::string_view, RE::TESForm*> FormsByName;
+	std::unordered_map<RE::FormType, FormsByName> m_formsByName;
+	KeywordMask m_glowableBookKeywords;
+	// all KYWDs that map to an ObjectType
+	KeywordMask m_objectTypeKeywords;
 	std::unordered_set<const RE::BGSPerk*> m_leveledItemOnDeathPerks;
 	// assume simple setters for now, like vanilla Green Thumb
 	std::unordered_map<const RE::BGSPerk*, float> m_modifyHarvestedPerkMultipliers;
@@ -316,24 +320,22 @@ private:
 	template <> ObjectType OverrideIfBadChoice<RE::TESObjectARMO>(const RE::TESForm* form, const ObjectType objectType);
 	template <> ObjectType OverrideIfBadChoice<RE::TESObjectWEAP>(const RE::TESForm* form, const ObjectType objectType);
 
-	std::unordered_map<std::string, ObjectType> m_objectTypeByActivationVerb;
-	mutable std::unordered_set<std::string> m_unhandledActivationVerbs;
+	std::unordered_map<std::string_view, ObjectType> m_objectTypeByActivationVerb;
+	mutable StringUtils::TransparentStringSet m_unhandledActivationVerbs;
 	std::unordered_map<const RE::TESObjectACTI*, ResourceType> m_resourceTypeByOreVein;
 
 	ObjectType GetObjectTypeForActivationText(const RE::BSString& activationText) const;
 
-	inline std::string GetVerbFromActivationText(const RE::BSString& activationText) const
+	// verb is the leading non-whitespace in the activation text, viewed in place
+	inline std::string_view GetVerbFromActivationText(const RE::BSString& activationText) const
 	{
-		std::string strActivation;
-		const char* nextChar(activationText.c_str());
-		size_t index(0);
-		while (!isspace(*nextChar) && index < activationText.size())
+		const char* text(activationText.c_str());
+		size_t length(0);
+		while (length < activationText.size() && !isspace(static_cast<unsigned char>(text[length])))
 		{
-			strActivation.push_back(*nextChar);
-			++nextChar;
-			++index;
+			++length;
 		}
-		return strActivation;
+		return std::string_view(text, length);
 	}
 
 	template <typename T>
@@ -365,7 +367,10 @@ private:
 			}
 
 			ObjectType correctType(ObjectType::unknown);
-			for (uint32_t index = 0; index < keywordForm->GetNumKeywords(); ++index)
+			// precomputed keyword bits rule out forms with no typed KYWD. If there is a match, walk the keywords in
+			// form order as that determines which of multiple typed KYWDs is used.
+			const bool hasTypedKeyword(KeywordIndex::Instance().HasAny(typedForm, m_objectTypeKeywords));
+			for (uint32_t index = 0; hasTypedKeyword && index < keywordForm->GetNumKeywords(); ++index)
 			{
 				std::optional<RE::BGSKeyword*> keyword(keywordForm->GetKeywordAt(index));
 				if (!keyword)
@@ -438,6 +443,32 @@ private:
 	void ExcludeMissivesBoards();
 	void ExcludeBuildYourNobleHouseIncomeChest();
 
+	// Name index for the form type, built by one pass of the form array on first lookup and shared by all special-case
+	// name matching thereafter
+	template <typename T>
+	const FormsByName& NamedForms()
+	{
+		const auto indexed(m_formsByName.find(T::FORMTYPE));
+		if (indexed != m_formsByName.cend())
+			return indexed->second;
+
+		FormsByName& namedForms(m_formsByName[T::FORMTYPE]);
+		RE::TESDataHandler* dhnd = RE::TESDataHandler::GetSingleton();
+		if (dhnd)
+		{
+			for (T* form : dhnd->GetFormArray<T>())
+			{
+				const char* name(form->GetName());
+				if (name && *name)
+				{
+					namedForms.insert({ name, form });
+				}
+			}
+		}
+		REL_MESSAGE("Indexed {} named forms of type {}", namedForms.size(), static_cast<int>(T::FORMTYPE));
+		return namedForms;
+	}
+
 	template <typename T>
 	T* FindBestMatch(const std::string& defaultESP, const RE::FormID maskedFormID, const std::string& name)
 	{
@@ -450,29 +481,21 @@ private:
 			return match;
 		}
 
-		// look for merged form
-		RE::TESDataHandler* dhnd = RE::TESDataHandler::GetSingleton();
-		if (!dhnd)
-			return nullptr;
-
-		// Check for match on name. FormID can change if this is in a merge output. Cannot use EDID as it is not loaded.
-		for (T* container : dhnd->GetFormArray<T>())
+		// Check for match on name to find merged form. FormID can change if this is in a merge output. Cannot use EDID
+		// as it is not loaded.
+		const auto named(NamedForms<T>().equal_range(name));
+		for (auto candidate = named.first; candidate != named.second; ++candidate)
 		{
-			if (container->GetName() == name)
+			T* container(static_cast<T*>(candidate->second));
+			if (match)
 			{
-				if (match)
-				{
-					REL_MESSAGE("Ambiguity in best match 0x{:08x} vs for 0x{:08x} for {}:0x{:06x}/{}",
-						match->GetFormID(), container->GetFormID(), defaultESP.c_str(), maskedFormID, name);
-					return nullptr;
-				}
-				else
-				{
-					REL_MESSAGE("Found best match 0x{:08x} for {}:0x{:06x}", container->GetFormID(),
-						defaultESP.c_str(), maskedFormID, name);
-					match = container;
-				}
+				REL_MESSAGE("Ambiguity in best match 0x{:08x} vs for 0x{:08x} for {}:0x{:06x}/{}",
+					match->GetFormID(), container->GetFormID(), defaultESP.c_str(), maskedFormID, name);
+				return nullptr;
 			}
+			REL_MESSAGE("Found best match 0x{:08x} for {}:0x{:06x}", container->GetFormID(),
+				defaultESP.c_str(), maskedFormID, name);
+			match = container;
 		}
 		return match;
 	}
@@ -480,18 +503,13 @@ private:
 	template <typename T>
 	std::unordered_set<T*> FindExactMatchesByName(const std::string& name)
 	{
-		std::unordered_set<T*> matches;
-		RE::TESDataHandler* dhnd = RE::TESDataHandler::GetSingleton();
-		if (!dhnd)
-			return matches;
-
 		// Check for match on name. FormID can change if this is in a merge output.
-		std::for_each(dhnd->GetFormArray<T>().cbegin(), dhnd->GetFormArray<T>().cend(), [&](T* entry) {
-			if (entry->GetName() == name)
-			{
-				matches.insert(entry);
-			}
-		});
+		std::unordered_set<T*> matches;
+		const auto named(NamedForms<T>().equal_range(name));
+		for (auto candidate = named.first; candidate != named.second; ++candidate)
+		{
+			matches.insert(static_cast<T*>(candidate->second));
+		}
 		return matches;
 	}
 
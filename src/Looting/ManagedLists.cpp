@@ -75,6 +75,7 @@ void ManagedList::Reset()
 		}
 		m_members.clear();
 	}
+	++m_generation;
 }
 
 void ManagedList::Add(RE::TESForm* entry)
@@ -92,6 +93,7 @@ void ManagedList::Add(RE::TESForm* entry)
 	REL_MESSAGE("{}/0x{:08x} added to {}", name, entry->GetFormID(), this == m_blackList.get() ? "BlackList" : "WhiteList");
 	RecursiveLockGuard guard(m_listLock);
 	m_members.insert({ entry->GetFormID(), name });
+	++m_generation;
 }
 
 bool ManagedList::Contains(const RE::TESForm* entry) const
@@ -146,6 +148,7 @@ void ManagedTargets::Add(RE::TESForm* entry)
 	RecursiveLockGuard guard(m_listLock);
 	m_members.insert({ entry->GetFormID(), name });
 	m_orderedList.push_back(entry);
+	++m_generation;
 
 	// Record any underlying _linked_ container for checking of multiplexed CONTs. We do not always check CONT for match as many are reused
 	// _without_ linked-ref indirection.
@@ -19,6 +19,8 @@ http://www.fsf.org/licensing/licenses
 *************************************************************************/
 #pragma once
 
+#include <atomic>
+
 namespace shse
 {
 
@@ -38,10 +40,13 @@ public:
 	virtual void Add(RE::TESForm* entry);
 	virtual bool Contains(const RE::TESForm* entry) const;
 	bool ContainsID(const RE::FormID entryID) const;
+	// advances whenever membership changes
+	inline uint64_t Generation() const { return m_generation; }
 
 protected:
 	std::unordered_map<RE::FormID, std::string> m_members;
 	mutable RecursiveLock m_listLock;
+	std::atomic<uint64_t> m_generation = 0;
 
 private:
 	bool HasEntryWithSameName(const RE::TESForm* form) const;
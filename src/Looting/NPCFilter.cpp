@@ -42,53 +42,25 @@ NPCFilter::NPCFilter() : m_active(false), m_logResults(false), m_defaultLoot(fal
 {
 }
 
-OrderedFilter::OrderedFilter(const nlohmann::json& j) : m_priority(0)
+OrderedFilter::OrderedFilter(const unsigned int priority, const NPCMatchDefinition& include, const NPCMatchDefinition& exclude) :
+	m_priority(priority)
 {
-	// parse includes/excludes, if either are present we proceed to build a dead body RACE/KYWD filter
+	// resolve includes/excludes, if either are present we proceed to build a dead body RACE/KYWD filter. Absent lists are empty.
+	m_excludeRaces = JSONUtils::ToForms<RE::TESRace>(exclude.m_races);
+	m_excludeFactions = JSONUtils::ToForms<RE::TESFaction>(exclude.m_factions);
 	std::unordered_set<std::string> excludeKeywords;
-	std::unordered_set<std::string> includeKeywords;
-	m_priority = j["priority"].get<unsigned int>();
-	if (j.contains("exclude"))
+	for (const std::string& next : exclude.m_keywords)
 	{
-		const nlohmann::json& excluded(j["exclude"]);
-		if (excluded.contains("race"))
-		{
-			m_excludeRaces = JSONUtils::ToForms<RE::TESRace>(excluded["race"]);
-		}
-		if (excluded.contains("faction"))
-		{
-			m_excludeFactions = JSONUtils::ToForms<RE::TESFaction>(excluded["faction"]);
-		}
-		if (excluded.contains("keyword"))
-		{
-			const nlohmann::json keywords(excluded["keyword"]);
-			for (const std::string& next : keywords)
-			{
-				DBG_MESSAGE("NPC Keyword {} excluded", next);
-				excludeKeywords.insert(next);
-			}
-		}
+		DBG_MESSAGE("NPC Keyword {} excluded", next);
+		excludeKeywords.insert(next);
 	}
-	if (j.contains("include"))
+	m_includeRaces = JSONUtils::ToForms<RE::TESRace>(include.m_races);
+	m_includeFactions = JSONUtils::ToForms<RE::TESFaction>(include.m_factions);
+	std::unordered_set<std::string> includeKeywords;
+	for (const std::string& next : include.m_keywords)
 	{
-		const nlohmann::json included(j["include"]);
-		if (included.contains("race"))
-		{
-			m_includeRaces = JSONUtils::ToForms<RE::TESRace>(included["race"]);
-		}
-		if (included.contains("faction"))
-		{
-			m_includeFactions = JSONUtils::ToForms<RE::TESFaction>(included["faction"]);
-		}
-		if (included.contains("keyword"))
-		{
-			const nlohmann::json keywords(included["keyword"]);
-			for (const std::string& next : keywords)
-			{
-				DBG_MESSAGE("NPC Keyword {} included", next);
-				includeKeywords.insert(next);
-			}
-		}
+		DBG_MESSAGE("NPC Keyword {} included", next);
+		includeKeywords.insert(next);
 	}
 
 	for (const auto& includeRace : m_includeRaces)
@@ -105,15 +77,8 @@ OrderedFilter::OrderedFilter(const nlohmann::json& j) : m_priority(0)
 			REL_WARNING("NPC Faction {}/0x{:08x} is in include and exclude list", includeFaction->GetName(), includeFaction->GetFormID());
 		}
 	}
-	for (const auto& includeKeyword : m_includeKeywords)
-	{
-		if (m_excludeKeywords.contains(includeKeyword))
-		{
-			REL_WARNING("NPC Keyword {}/0x{:08x} is in include and exclude list", FormUtils::SafeGetFormEditorID(includeKeyword), includeKeyword->GetFormID());
-		}
-	}
 
-	// Bucket configured Keywords into fast filters
+	// Bucket configured Keywords into precomputed keyword bitsets
 	RE::TESDataHandler* dhnd = RE::TESDataHandler::GetSingleton();
 	for (const RE::BGSKeyword* keyword : dhnd->GetFormArray<RE::BGSKeyword>())
 	{
@@ -124,11 +89,15 @@ OrderedFilter::OrderedFilter(const nlohmann::json& j) : m_priority(0)
 		}
 		if (excludeKeywords.contains(keywordName))
 		{
-			m_excludeKeywords.insert(keyword);
+			if (includeKeywords.contains(keywordName))
+			{
+				REL_WARNING("NPC Keyword {}/0x{:08x} is in include and exclude list", keywordName, keyword->GetFormID());
+			}
+			KeywordIndex::Instance().Register(keyword, m_excludeKeywords);
 		}
 		else if (includeKeywords.contains(keywordName))
 		{
-			m_includeKeywords.insert(keyword);
+			KeywordIndex::Instance().Register(keyword, m_includeKeywords);
 		}
 	}
 }
@@ -164,33 +133,13 @@ bool OrderedFilter::DeterminesLootability(const RE::TESNPC* npc, bool& isLootabl
 		}
 	}
 	// check for exclude/include keywords, if filter uses them
-	bool hasIncludeKeyword(false);
-	if (!m_excludeKeywords.empty() || !m_includeKeywords.empty())
+	if (KeywordIndex::Instance().HasAny(race, m_excludeKeywords))
 	{
-		for (std::uint32_t index = 0; index < race->GetNumKeywords(); ++index)
-		{
-			std::optional<RE::BGSKeyword*> keyword(race->GetKeywordAt(index));
-			if (keyword.has_value())
-			{
-				std::string keywordName(FormUtils::SafeGetFormEditorID(keyword.value()));
-				if (keywordName.empty())
-				{
-					continue;
-				}
-				if (m_excludeKeywords.contains(keyword.value()))
-				{
-					// immediately dispositive
-					isLootable = false;
-					return true;
-				}
-				if (!hasIncludeKeyword && m_includeKeywords.contains(keyword.value()))
-				{
-					// delayed disposition, in case a later keyword excludes this NPC
-					hasIncludeKeyword = true;
-				}
-			}
-		}
+		// immediately dispositive
+		isLootable = false;
+		return true;
 	}
+	const bool hasIncludeKeyword(KeywordIndex::Instance().HasAny(race, m_includeKeywords));
 
 	if (hasIncludeFaction || hasIncludeKeyword || m_includeRaces.contains(race))
 	{
@@ -204,47 +153,26 @@ bool OrderedFilter::DeterminesLootability(const RE::TESNPC* npc, bool& isLootabl
 void NPCFilter::Load()
 {
 	try {
-		// Validate the schema
-		const std::string schemaFileName("SHSE.SchemaFilters.json");
-		std::string filePath(FileUtils::GetPluginPath() + schemaFileName);
-		nlohmann::json_schema::json_validator validator;
-		try {
-			std::ifstream schemaFile(filePath);
-			if (schemaFile.fail()) {
-				throw FileNotFound(filePath.c_str());
-			}
-			nlohmann::json schema(nlohmann::json::parse(schemaFile));
-			validator.set_root_schema(schema); // insert root-schema
-		}
-		catch (const std::exception& e) {
-			REL_ERROR("JSON Filters Schema {} not loadable, error:\n{}", filePath, e.what());
-			return;
-		}
-
-		REL_MESSAGE("JSON Filters Schema {} parsed and validated", filePath.c_str());
 		// check if dead body race filtering file is present
 		const std::string filterFileName("SHSE.Filter.DeadBody.json");
-		filePath = FileUtils::GetPluginPath() + filterFileName;
-		std::ifstream filterFile(filePath);
+		const std::string filePath(FileUtils::GetPluginPath() + filterFileName);
+		std::ifstream filterFile(filePath, std::ios::binary);
 		if (filterFile.fail()) {
 			REL_MESSAGE("NPC AutoLoot Filtering not configured in {}", filterFileName);
 			return;
 		}
 
-		const nlohmann::json filterData(nlohmann::json::parse(filterFile));
-		const nlohmann::json filters(filterData["npc"]);
-		m_defaultLoot = filters["defaultLoot"].get<bool>();
-		REL_MESSAGE("Default looting = {}", m_defaultLoot ? "true" : "false");
-
-		m_excludePlayerRace = filters["excludePlayerRace"].get<bool>();
-		REL_MESSAGE("Exclude Player Race = {}", m_excludePlayerRace ? "true" : "false");
-
-		for (const auto& nextFilter : filters["orderedFilter"])
-		{
-			m_orderedFilters.insert(std::move(new OrderedFilter(nextFilter)));
-		}
+		// SHSE.SchemaFilters.json is enforced while the file is read. Nothing is resolved unless the whole file is valid.
+		const auto startTime(std::chrono::high_resolution_clock::now());
+		const std::string filterText((std::istreambuf_iterator<char>(filterFile)), std::istreambuf_iterator<char>());
+		const NPCFilterDefinition definition(ReadNPCFilterDefinition(filterText));
+		Build(definition);
+		REL_MESSAGE("NPC AutoLoot Filtering JSON read and built in {} microseconds", std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::high_resolution_clock::now() - startTime).count());
 		REL_MESSAGE("NPC AutoLoot Filtering JSON loaded OK from {}", filePath);
 		m_active = true;
+		// RACE keyword bits must include the filter KYWDs before NPCs are pretested
+		KeywordIndex::Instance().IndexForms();
 	}
 	catch (const std::exception& exc) {
 		REL_ERROR("NPC AutoLoot Filtering failed to initalize:\n{}", exc.what());
@@ -273,6 +201,20 @@ void NPCFilter::Load()
 	m_logResults = false;
 }
 
+void NPCFilter::Build(const NPCFilterDefinition& definition)
+{
+	m_defaultLoot = definition.m_defaultLoot;
+	REL_MESSAGE("Default looting = {}", m_defaultLoot ? "true" : "false");
+
+	m_excludePlayerRace = definition.m_excludePlayerRace;
+	REL_MESSAGE("Exclude Player Race = {}", m_excludePlayerRace ? "true" : "false");
+
+	for (const auto& orderedFilter : definition.m_orderedFilters)
+	{
+		m_orderedFilters.insert(new OrderedFilter(orderedFilter.m_priority, orderedFilter.m_include, orderedFilter.m_exclude));
+	}
+}
+
 bool NPCFilter::IsLeveled(const RE::TESNPC* npc) const
 {
 	return NPCIsLeveled(npc);
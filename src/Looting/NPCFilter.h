@@ -19,20 +19,22 @@ http://www.fsf.org/licensing/licenses
 *************************************************************************/
 #pragma once
 
+#include "Data/KeywordIndex.h"
+#include "Looting/NPCFilterReader.h"
 #include "Utilities/utils.h"
 
 namespace shse
 {
 class OrderedFilter {
 public:
-	OrderedFilter(const nlohmann::json& j);
+	OrderedFilter(const unsigned int priority, const NPCMatchDefinition& include, const NPCMatchDefinition& exclude);
 	bool DeterminesLootability(const RE::TESNPC* npc, bool& isLootable) const;
 	inline size_t Priority() const { return m_priority; }
 private:
-	std::unordered_set<const RE::BGSKeyword*> m_excludeKeywords;
+	KeywordMask m_excludeKeywords;
 	std::unordered_set<const RE::TESRace*> m_excludeRaces;
 	std::unordered_set<const RE::TESFaction*> m_excludeFactions;
-	std::unordered_set<const RE::BGSKeyword*> m_includeKeywords;
+	KeywordMask m_includeKeywords;
 	std::unordered_set<const RE::TESRace*> m_includeRaces;
 	std::unordered_set<const RE::TESFaction*> m_includeFactions;
 	size_t m_priority;
@@ -53,6 +55,7 @@ public:
 
 private:
 	bool IsLeveled(const RE::TESNPC* npc) const;
+	void Build(const NPCFilterDefinition& definition);
 
 	// no lock as all public functions are const once loaded
 	static std::unique_ptr<NPCFilter> m_instance;
@@ -0,0 +1,177 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#include "PrecompiledHeaders.h"
+
+#include "Looting/NPCFilterReader.h"
+
+namespace shse
+{
+
+namespace
+{
+
+constexpr StringListRule KeywordRule = { 1, 10, false, {}, false };
+
+constexpr std::string_view MatchMembers[] = { "race", "faction", "keyword" };
+
+class MatchNode : public ObjectNode {
+public:
+	MatchNode(NPCMatchDefinition& target) : ObjectNode(MatchMembers), m_target(target) {}
+
+	virtual ReadNodePtr MemberArray() override
+	{
+		switch (m_member)
+		{
+		case Race:
+			return std::make_unique<FormsListNode>(1, 10, false, m_target.m_races);
+		case Faction:
+			return std::make_unique<FormsListNode>(1, 10, false, m_target.m_factions);
+		default:
+			return std::make_unique<StringListNode>(KeywordRule, m_target.m_keywords);
+		}
+	}
+	virtual void End() override
+	{
+		if (!Has(Race) && !Has(Faction) && !Has(Keyword))
+		{
+			Reject("requires at least one of 'race', 'faction', 'keyword'");
+		}
+	}
+
+private:
+	enum Member : size_t { Race, Faction, Keyword };
+	NPCMatchDefinition& m_target;
+};
+
+constexpr std::string_view OrderedFilterMembers[] = { "priority", "include", "exclude" };
+
+class OrderedFilterNode : public ObjectNode {
+public:
+	OrderedFilterNode(OrderedFilterDefinition& target) : ObjectNode(OrderedFilterMembers), m_target(target) {}
+
+	virtual ReadNodePtr MemberObject() override
+	{
+		if (m_member == Include)
+			return std::make_unique<MatchNode>(m_target.m_include);
+		if (m_member == Exclude)
+			return std::make_unique<MatchNode>(m_target.m_exclude);
+		return ObjectNode::MemberObject();
+	}
+	virtual void MemberInteger(const long long value) override
+	{
+		if (m_member != Priority)
+			return ObjectNode::MemberInteger(value);
+		// the schema allows any integer, narrowed as the DOM path did
+		m_target.m_priority = static_cast<unsigned int>(value);
+	}
+	virtual void End() override
+	{
+		Require(Priority);
+		if (!Has(Include) && !Has(Exclude))
+		{
+			Reject("requires at least one of 'include', 'exclude'");
+		}
+	}
+
+private:
+	enum Member : size_t { Priority, Include, Exclude };
+	OrderedFilterDefinition& m_target;
+};
+
+class OrderedFilterListNode : public ReadNode {
+public:
+	OrderedFilterListNode(std::vector<OrderedFilterDefinition>& target) : m_target(target) {}
+
+	virtual ReadNodePtr Object() override
+	{
+		return std::make_unique<OrderedFilterNode>(m_target.emplace_back());
+	}
+	virtual void End() override
+	{
+		CheckItemCount(m_target.size(), 1, 5);
+	}
+
+private:
+	std::vector<OrderedFilterDefinition>& m_target;
+};
+
+constexpr std::string_view NPCMembers[] = { "defaultLoot", "excludePlayerRace", "orderedFilter" };
+
+class NPCNode : public ObjectNode {
+public:
+	NPCNode(NPCFilterDefinition& target) : ObjectNode(NPCMembers), m_target(target) {}
+
+	virtual ReadNodePtr MemberArray() override
+	{
+		if (m_member != OrderedFilter)
+			return ObjectNode::MemberArray();
+		return std::make_unique<OrderedFilterListNode>(m_target.m_orderedFilters);
+	}
+	virtual void MemberBoolean(const bool value) override
+	{
+		if (m_member == DefaultLoot)
+			m_target.m_defaultLoot = value;
+		else if (m_member == ExcludePlayerRace)
+			m_target.m_excludePlayerRace = value;
+		else
+			ObjectNode::MemberBoolean(value);
+	}
+	virtual void End() override
+	{
+		Require(DefaultLoot);
+		Require(ExcludePlayerRace);
+		Require(OrderedFilter);
+	}
+
+private:
+	enum Member : size_t { DefaultLoot, ExcludePlayerRace, OrderedFilter };
+	NPCFilterDefinition& m_target;
+};
+
+constexpr std::string_view FiltersMembers[] = { "npc" };
+
+class FiltersNode : public ObjectNode {
+public:
+	FiltersNode(NPCFilterDefinition& target) : ObjectNode(FiltersMembers), m_target(target) {}
+
+	virtual ReadNodePtr MemberObject() override
+	{
+		return std::make_unique<NPCNode>(m_target);
+	}
+	virtual void End() override
+	{
+		Require(Npc);
+	}
+
+private:
+	enum Member : size_t { Npc };
+	NPCFilterDefinition& m_target;
+};
+
+}
+
+NPCFilterDefinition ReadNPCFilterDefinition(const std::string& text)
+{
+	NPCFilterDefinition definition{};
+	ReadDefinition(text, std::make_unique<FiltersNode>(definition));
+	return definition;
+}
+
+}
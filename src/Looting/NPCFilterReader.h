@@ -0,0 +1,50 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#pragma once
+
+#include "Utilities/DefinitionReader.h"
+
+namespace shse
+{
+
+// schema matchType: any of these may be empty, but not all
+struct NPCMatchDefinition {
+	FormsDefinition m_races;
+	FormsDefinition m_factions;
+	std::vector<std::string> m_keywords;
+};
+
+struct OrderedFilterDefinition {
+	unsigned int m_priority;
+	NPCMatchDefinition m_include;
+	NPCMatchDefinition m_exclude;
+};
+
+// NPC filters of SHSE.Filter.DeadBody.json in file order, already checked against SHSE.SchemaFilters.json
+struct NPCFilterDefinition {
+	bool m_defaultLoot;
+	bool m_excludePlayerRace;
+	std::vector<OrderedFilterDefinition> m_orderedFilters;
+};
+
+// Read an NPC filter file in one pass, enforcing SHSE.SchemaFilters.json inline. Throws DefinitionError.
+NPCFilterDefinition ReadNPCFilterDefinition(const std::string& text);
+
+}
@@ -19,6 +19,8 @@ http://www.fsf.org/licensing/licenses
 *************************************************************************/
 #pragma once
 
+#include "Utilities/EnumTable.h"
+
 namespace ObjTypeName
 {
 	constexpr const char* Critter = "critter";
@@ -61,7 +63,8 @@ enum class ObjectType : uint8_t
 	drink,
 	oreVein,
 	container,
-	actor
+	actor,
+	MAX
 };
 
 enum class ResourceType : uint8_t
@@ -72,10 +75,19 @@ enum class ResourceType : uint8_t
 	volcanicDigSite
 };
 
+constexpr EnumUtils::EnumNameTable<ResourceType, 4> ResourceTypeNames = {{
+	{ResourceType::ore, "Ore"},
+	{ResourceType::geode, "Geode"},
+	{ResourceType::volcanic, "Volcanic"},
+	{ResourceType::volcanicDigSite, "VolcanicDigSite"}
+}};
+static_assert(EnumUtils::IsDense(ResourceTypeNames) && ResourceTypeNames.size() == size_t(ResourceType::volcanicDigSite) + 1);
+static_assert(EnumUtils::HasUniqueEntries(ResourceTypeNames));
+
 inline const char* PrintResourceType(ResourceType resourceType)
 {
-	static std::vector<const char*> resourceTypeNames = { "Ore", "Geode", "Volcanic", "VolcanicDigSite" };
-	return resourceTypeNames.at(static_cast<size_t>(resourceType));
+	// table entries are string literals, so the view is null-terminated
+	return ResourceTypeNames.at(static_cast<size_t>(resourceType)).name.data();
 }
 
 inline bool TypeIsEnchanted(const ObjectType objType)
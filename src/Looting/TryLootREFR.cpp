@@ -1009,18 +1009,7 @@ bool TryLootREFR::HarvestForbiddenForForm(const RE::TESForm* form) const
 
 bool TryLootREFR::IsBookGlowable() const
 {
-	RE::BGSKeywordForm* keywordForm(m_candidate->GetBaseObject()->As<RE::BGSKeywordForm>());
-	if (!keywordForm)
-		return false;
-	for (uint32_t index = 0; index < keywordForm->GetNumKeywords(); ++index)
-	{
-		std::optional<RE::BGSKeyword*> keyword(keywordForm->GetKeywordAt(index));
-		if (!keyword || !keyword.has_value())
-			continue;
-		if (DataCase::GetInstance()->IsBookGlowableKeyword(keyword.value()))
-			return true;
-	}
-	return false;
+	return DataCase::GetInstance()->IsBookGlowable(m_candidate->GetBaseObject());
 }
 
 }
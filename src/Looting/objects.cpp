@@ -237,7 +237,7 @@ ObjectType GetExcessObjectType(const RE::TESBoundObject* baseForm)
 	return objType;
 }
 
-const std::unordered_map<RE::FormType, std::string> nameByFormType({
+constexpr EnumUtils::EnumNameTable<RE::FormType, 9> nameByFormType = {{
 	{RE::FormType::ActorCharacter, "ActorCharacter"},
 	{RE::FormType::Container, "Container"},
 	{RE::FormType::Ingredient, "Ingredient"},
@@ -247,17 +247,19 @@ const std::unordered_map<RE::FormType, std::string> nameByFormType({
 	{RE::FormType::Ammo, "Ammo"},
 	{RE::FormType::ProjectileArrow, "ProjectileArrow"},
 	{RE::FormType::Light, "Light"}
-	});
+}};
+static_assert(EnumUtils::HasUniqueEntries(nameByFormType));
 
 std::string GetFormTypeName(const RE::FormType formType)
 {
-	const auto result(nameByFormType.find(formType));
-	if (result != nameByFormType.cend())
-		return result->second;
+	const auto result(EnumUtils::FindByValue(nameByFormType, formType));
+	if (result)
+		return std::string(result->name);
 	return "unknown";
 }
 
-const std::unordered_map<ObjectType, std::string> nameByObjectType({
+// indexed by ObjectType, names are lower case to match INI keys
+constexpr EnumUtils::EnumNameTable<ObjectType, size_t(ObjectType::MAX)> nameByObjectType = {{
 	{ObjectType::unknown, "unknown"},
 	{ObjectType::flora, ObjTypeName::Flora},
 	{ObjectType::critter, ObjTypeName::Critter},
@@ -291,46 +293,39 @@ const std::unordered_map<ObjectType, std::string> nameByObjectType({
 	{ObjectType::oreVein, "orevein"},
 	{ObjectType::container, "container"},
 	{ObjectType::actor, "actor"}
-	});
+}};
+static_assert(EnumUtils::IsDense(nameByObjectType));
+static_assert(EnumUtils::HasUniqueEntries(nameByObjectType) && EnumUtils::IsLowerCase(nameByObjectType));
+constexpr auto objectTypeByName(EnumUtils::SortedByName(nameByObjectType));
+static_assert(EnumUtils::IsSortedByName(objectTypeByName));
 
 std::string GetObjectTypeName(const ObjectType objectType)
 {
-	const auto result(nameByObjectType.find(objectType));
-	if (result != nameByObjectType.cend())
-		return result->second;
-	return "unknown";
+	return std::string(EnumUtils::NameOf(nameByObjectType, objectType, "unknown"));
 }
 
 ObjectType GetObjectTypeByTypeName(const std::string& name)
 {
-	// normalize from BSFixedString
-	std::string lcName;
-	std::transform(name.cbegin(), name.cend(), std::back_inserter(lcName), [](const char& c) { return static_cast<char>(std::tolower(c)); });
-	for (const auto& nextPair : nameByObjectType)
+	// case-insensitive match, input may come from BSFixedString
+	const auto matched(EnumUtils::FindByName(objectTypeByName, name, true));
+	if (matched)
 	{
-		if (nextPair.second == lcName)
-		{
-			DBG_VMESSAGE("Mapped name {} to ObjectType {}", name.c_str(), nextPair.first);
-			return nextPair.first;
-		}
+		DBG_VMESSAGE("Mapped name {} to ObjectType {}", name.c_str(), matched->value);
+		return matched->value;
 	}
 	DBG_WARNING("Unmapped ObjectType name {}", name.c_str());
 	return ObjectType::unknown;
 }
 
-const std::unordered_map<std::string, ResourceType> resourceTypeByName({
-	{"Ore", ResourceType::ore},
-	{"Geode", ResourceType::geode},
-	{"Volcanic", ResourceType::volcanic},
-	{"VolcanicDigSite", ResourceType::volcanicDigSite}
-	});
+constexpr auto resourceTypeByName(EnumUtils::SortedByName(ResourceTypeNames));
+static_assert(EnumUtils::IsSortedByName(resourceTypeByName));
 
 ResourceType ResourceTypeByName(const std::string& name)
 {
-	const auto matched(resourceTypeByName.find(name));
-	if (matched != resourceTypeByName.cend())
+	const auto matched(EnumUtils::FindByName(resourceTypeByName, name));
+	if (matched)
 	{
-		return matched->second;
+		return matched->value;
 	}
 	return ResourceType::ore;
 }
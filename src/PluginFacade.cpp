@@ -25,11 +25,14 @@ http://www.fsf.org/licensing/licenses
 #include "Collections/CollectionManager.h"
 #include "Data/CosaveData.h"
 #include "Data/dataCase.h"
+#include "Data/LeveledListCache.h"
 #include "Data/LoadOrder.h"
 #include "Data/SettingsCache.h"
 #include "VM/UIState.h"
 #include "WorldState/ActorTracker.h"
 #include "WorldState/AdventureTargets.h"
+#include "WorldState/AttachedCells.h"
+#include "WorldState/InventoryTracker.h"
 #include "WorldState/LocationTracker.h"
 #include "WorldState/PlacedObjects.h"
 #include "WorldState/PlayerHouses.h"
@@ -135,6 +138,16 @@ void PluginFacade::Start()
 		{
 		}
 	}).detach();
+	std::thread([]()
+	{
+		__try
+		{
+			CosaveThread();
+		}
+		__except (LogStackWalker::LogStack(GetExceptionInformation()))
+		{
+		}
+	}).detach();
 }
 
 bool PluginFacade::Load()
@@ -171,10 +184,16 @@ bool PluginFacade::Load()
 	// Quest Target identification relies on Placed Objects analysis
 	REL_MESSAGE("*** LOAD *** Analyze Quest Targets");
 	QuestTargets::Instance().Analyze();
+	// flattened LVLIs are only needed for produce categorization and Quest Target analysis
+	LeveledListCache::Instance().Release();
 
 	// Collections are layered on top of categorized and placed objects
 	REL_MESSAGE("*** LOAD *** Build Collections");
 	CollectionManager::Instance().ProcessDefinitions();
+	// Collections track player inventory changes incrementally
+	InventoryTracker::Instance().Register();
+	// adjacent exterior CELLs are looked up by grid position
+	AttachedCells::Instance().Register();
 
 	REL_MESSAGE("Plugin Data load complete!");
 	return true;
@@ -207,6 +226,20 @@ bool PluginFacade::ScanAllowed() const {
 	return true;
 }
 
+// keeps encoded cosave records current so the save callback mostly writes pre-encoded bytes
+void PluginFacade::CosaveThread()
+{
+	REL_MESSAGE("Starting SHSE Cosave Thread");
+	while (true)
+	{
+		WindowsUtils::TakeNap(CosavePreEncodeSeconds);
+		// state is in flux during game load
+		if (!Instance().IsSynced())
+			continue;
+		CosaveData::Instance().PreEncode();
+	}
+}
+
 void PluginFacade::ScanThread()
 {
 	REL_MESSAGE("Starting SHSE Worker Thread");
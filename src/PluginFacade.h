@@ -44,10 +44,13 @@ private:
 	void Start();
 	bool IsSynced() const;
 	static void ScanThread(void);
+	static void CosaveThread(void);
 	inline bool Loaded() const { return m_loadProgress == LoadProgress::Complete; }
 
 	// Worker thread loop smallest possible delay
 	static constexpr double MinThreadDelaySeconds = 0.1;
+	// Cosave records changed since the last pass are encoded in the background at this interval
+	static constexpr double CosavePreEncodeSeconds = 10.0;
 
 	static std::unique_ptr<PluginFacade> m_instance;
 	mutable RecursiveLock m_pluginLock;
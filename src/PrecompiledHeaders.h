@@ -24,7 +24,6 @@ http://www.fsf.org/licensing/licenses
 #include "CommonLibSSE/include/SKSE/SKSE.h"
 
 #include "nlohmann/json.hpp"
-#include "nlohmann/json-schema.hpp"
 
 #include <string>
 #include <vector>
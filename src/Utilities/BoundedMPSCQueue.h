@@ -0,0 +1,121 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <optional>
+
+namespace shse
+{
+
+// Bounded lock-free multi-producer single-consumer queue, after Vyukov's bounded MPMC design. Each cell carries a
+// sequence number that tells a producer the cell is free for this lap and tells the consumer it has been published.
+// Producers never block: a push into a full queue fails and is counted as overflow for the consumer to report.
+template <typename T, size_t Capacity>
+class BoundedMPSCQueue
+{
+	static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+	BoundedMPSCQueue() : m_enqueuePosition(0), m_dequeuePosition(0), m_overflow(0)
+	{
+		for (size_t index = 0; index < Capacity; ++index)
+		{
+			m_cells[index].m_sequence.store(index, std::memory_order_relaxed);
+		}
+	}
+
+	// any thread
+	template <typename... Args>
+	bool TryPush(Args&&... args)
+	{
+		size_t position(m_enqueuePosition.load(std::memory_order_relaxed));
+		for (;;)
+		{
+			Cell& cell(m_cells[position & Mask]);
+			const size_t sequence(cell.m_sequence.load(std::memory_order_acquire));
+			const intptr_t lap(static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position));
+			if (lap == 0)
+			{
+				if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					cell.m_value.emplace(std::forward<Args>(args)...);
+					cell.m_sequence.store(position + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (lap < 0)
+			{
+				// consumer has not yet freed this cell from the previous lap
+				m_overflow.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+			else
+			{
+				// another producer claimed this position
+				position = m_enqueuePosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	// consumer thread only - appends published items in FIFO order, stops at the first claimed but unpublished cell
+	template <typename Container>
+	size_t Drain(Container& output)
+	{
+		size_t drained(0);
+		for (;;)
+		{
+			Cell& cell(m_cells[m_dequeuePosition & Mask]);
+			if (cell.m_sequence.load(std::memory_order_acquire) != m_dequeuePosition + 1)
+				break;
+			output.emplace_back(std::move(*cell.m_value));
+			cell.m_value.reset();
+			cell.m_sequence.store(m_dequeuePosition + Capacity, std::memory_order_release);
+			++m_dequeuePosition;
+			++drained;
+		}
+		return drained;
+	}
+
+	// consumer thread only
+	size_t TakeOverflow()
+	{
+		return m_overflow.exchange(0, std::memory_order_relaxed);
+	}
+
+private:
+	static constexpr size_t Mask = Capacity - 1;
+	// keep producer and consumer positions on separate cache lines
+	static constexpr size_t CacheLine = 64;
+
+	struct Cell
+	{
+		std::atomic<size_t> m_sequence;
+		std::optional<T> m_value;
+	};
+
+	std::array<Cell, Capacity> m_cells;
+	alignas(CacheLine) std::atomic<size_t> m_enqueuePosition;
+	alignas(CacheLine) size_t m_dequeuePosition;
+	alignas(CacheLine) std::atomic<size_t> m_overflow;
+};
+
+}
@@ -0,0 +1,149 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#include "PrecompiledHeaders.h"
+
+#include "Utilities/BrotliStream.h"
+
+namespace CompressionUtils
+{
+	BrotliOutputBuffer::BrotliOutputBuffer(std::string& output, const bool isText) :
+		m_output(output), m_encoder(BrotliEncoderCreateInstance(nullptr, nullptr, nullptr)),
+		m_pending(ChunkSize), m_compressed(ChunkSize), m_plainLength(0), m_failed(m_encoder == nullptr)
+	{
+		// uncompressed length is not known until the stream is finished, reserve its slot
+		m_output.assign(sizeof(size_t), 0);
+		if (m_encoder)
+		{
+			static constexpr uint32_t BrotliQuality(1);	// favour fast speed over small size
+			BrotliEncoderSetParameter(m_encoder, BROTLI_PARAM_QUALITY, BrotliQuality);
+			BrotliEncoderSetParameter(m_encoder, BROTLI_PARAM_MODE, isText ? BROTLI_MODE_TEXT : BROTLI_MODE_GENERIC);
+		}
+		setp(m_pending.data(), m_pending.data() + m_pending.size());
+	}
+
+	BrotliOutputBuffer::~BrotliOutputBuffer()
+	{
+		if (m_encoder)
+		{
+			BrotliEncoderDestroyInstance(m_encoder);
+		}
+	}
+
+	BrotliOutputBuffer::int_type BrotliOutputBuffer::overflow(int_type ch)
+	{
+		if (!CompressPending(BROTLI_OPERATION_PROCESS))
+			return traits_type::eof();
+		if (!traits_type::eq_int_type(ch, traits_type::eof()))
+		{
+			*pptr() = traits_type::to_char_type(ch);
+			pbump(1);
+		}
+		return traits_type::not_eof(ch);
+	}
+
+	bool BrotliOutputBuffer::CompressPending(const BrotliEncoderOperation operation)
+	{
+		if (m_failed)
+			return false;
+		size_t availableIn(static_cast<size_t>(pptr() - pbase()));
+		m_plainLength += availableIn;
+		const uint8_t* nextIn(reinterpret_cast<const uint8_t*>(pbase()));
+		do
+		{
+			size_t availableOut(m_compressed.size());
+			uint8_t* nextOut(m_compressed.data());
+			if (!BrotliEncoderCompressStream(m_encoder, operation, &availableIn, &nextIn, &availableOut, &nextOut, nullptr))
+			{
+				m_failed = true;
+				return false;
+			}
+			m_output.append(reinterpret_cast<const char*>(m_compressed.data()), m_compressed.size() - availableOut);
+		} while (availableIn > 0 || BrotliEncoderHasMoreOutput(m_encoder) ||
+			(operation == BROTLI_OPERATION_FINISH && !BrotliEncoderIsFinished(m_encoder)));
+		setp(m_pending.data(), m_pending.data() + m_pending.size());
+		return true;
+	}
+
+	bool BrotliOutputBuffer::Finish()
+	{
+		if (!CompressPending(BROTLI_OPERATION_FINISH))
+			return false;
+		std::copy_n(reinterpret_cast<const char*>(&m_plainLength), sizeof(size_t), m_output.begin());
+		return true;
+	}
+
+	BrotliInputBuffer::BrotliInputBuffer(const std::string& compressed) :
+		m_decoder(BrotliDecoderCreateInstance(nullptr, nullptr, nullptr)), m_nextIn(nullptr), m_availableIn(0),
+		m_plainLength(0), m_inflated(ChunkSize), m_finished(false), m_failed(m_decoder == nullptr)
+	{
+		if (compressed.length() < sizeof(size_t))
+		{
+			m_failed = true;
+		}
+		else
+		{
+			std::copy_n(compressed.data(), sizeof(size_t), reinterpret_cast<char*>(&m_plainLength));
+			m_nextIn = reinterpret_cast<const uint8_t*>(compressed.data() + sizeof(size_t));
+			m_availableIn = compressed.length() - sizeof(size_t);
+		}
+		setg(m_inflated.data(), m_inflated.data(), m_inflated.data());
+	}
+
+	BrotliInputBuffer::~BrotliInputBuffer()
+	{
+		if (m_decoder)
+		{
+			BrotliDecoderDestroyInstance(m_decoder);
+		}
+	}
+
+	BrotliInputBuffer::int_type BrotliInputBuffer::underflow()
+	{
+		if (gptr() < egptr())
+			return traits_type::to_int_type(*gptr());
+		while (!m_finished && !m_failed)
+		{
+			size_t availableOut(m_inflated.size());
+			uint8_t* nextOut(reinterpret_cast<uint8_t*>(m_inflated.data()));
+			const BrotliDecoderResult result(
+				BrotliDecoderDecompressStream(m_decoder, &m_availableIn, &m_nextIn, &availableOut, &nextOut, nullptr));
+			const size_t inflated(m_inflated.size() - availableOut);
+			if (result == BROTLI_DECODER_RESULT_ERROR)
+			{
+				REL_ERROR("Inflating record failed, error {}", BrotliDecoderErrorString(BrotliDecoderGetErrorCode(m_decoder)));
+				m_failed = true;
+				break;
+			}
+			m_finished = result == BROTLI_DECODER_RESULT_SUCCESS;
+			if (result == BROTLI_DECODER_RESULT_NEEDS_MORE_INPUT && inflated == 0)
+			{
+				REL_ERROR("Inflating record failed, input truncated");
+				m_failed = true;
+				break;
+			}
+			if (inflated > 0)
+			{
+				setg(m_inflated.data(), m_inflated.data(), m_inflated.data() + inflated);
+				return traits_type::to_int_type(*gptr());
+			}
+		}
+		return traits_type::eof();
+	}
+}
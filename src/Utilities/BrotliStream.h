@@ -0,0 +1,80 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#pragma once
+
+#include <streambuf>
+
+#include <brotli/decode.h>
+#include <brotli/encode.h>
+
+namespace CompressionUtils
+{
+	// Brotli-compressing stream buffer. Output is a size_t holding the uncompressed length, followed by the compressed
+	// stream. Input is staged and compressed in fixed-size chunks, so the plain text is never held in full.
+	class BrotliOutputBuffer : public std::streambuf
+	{
+	public:
+		BrotliOutputBuffer(std::string& output, const bool isText);
+		virtual ~BrotliOutputBuffer();
+		// compress pending input, close the brotli stream and record the uncompressed length at the head of the output.
+		// Returns false if the encoder failed at any point.
+		bool Finish();
+		inline size_t PlainLength() const { return m_plainLength; }
+
+	protected:
+		virtual int_type overflow(int_type ch) override;
+
+	private:
+		bool CompressPending(const BrotliEncoderOperation operation);
+
+		static constexpr size_t ChunkSize = 64 * 1024;
+		std::string& m_output;
+		BrotliEncoderState* m_encoder;
+		std::vector<char> m_pending;
+		std::vector<uint8_t> m_compressed;
+		size_t m_plainLength;
+		bool m_failed;
+	};
+
+	// Brotli-inflating stream buffer over a record written by BrotliOutputBuffer or its predecessor. Output is
+	// inflated on demand in fixed-size chunks, and reads as end-of-file if the stream is corrupt or truncated.
+	class BrotliInputBuffer : public std::streambuf
+	{
+	public:
+		BrotliInputBuffer(const std::string& compressed);
+		virtual ~BrotliInputBuffer();
+		// uncompressed length recorded by the writer
+		inline size_t PlainLength() const { return m_plainLength; }
+		inline bool Failed() const { return m_failed; }
+
+	protected:
+		virtual int_type underflow() override;
+
+	private:
+		static constexpr size_t ChunkSize = 64 * 1024;
+		BrotliDecoderState* m_decoder;
+		const uint8_t* m_nextIn;
+		size_t m_availableIn;
+		size_t m_plainLength;
+		std::vector<char> m_inflated;
+		bool m_finished;
+		bool m_failed;
+	};
+}
@@ -0,0 +1,463 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#include "PrecompiledHeaders.h"
+
+#include <climits>
+
+#include "Utilities/DefinitionReader.h"
+
+namespace shse
+{
+
+DefinitionError::DefinitionError(const std::string& path, const std::string& reason) :
+	std::runtime_error(std::string(DefinitionError::ErrorName) + "at '" + path + "': " + reason)
+{
+}
+
+void ReadNode::Key(const std::string&)
+{
+}
+
+ReadNodePtr ReadNode::Object()
+{
+	Reject("unexpected object");
+}
+
+ReadNodePtr ReadNode::Array()
+{
+	Reject("unexpected array");
+}
+
+void ReadNode::String(std::string&&)
+{
+	Reject("unexpected string");
+}
+
+void ReadNode::Boolean(const bool)
+{
+	Reject("unexpected boolean");
+}
+
+void ReadNode::Integer(const long long)
+{
+	Reject("unexpected integer");
+}
+
+void ReadNode::Other()
+{
+	Reject("unexpected null or number");
+}
+
+void ReadNode::End()
+{
+}
+
+void ReadNode::Reject(const std::string& reason)
+{
+	throw Rejected{ reason };
+}
+
+ReadNodePtr SkipNode::Object()
+{
+	return std::make_unique<SkipNode>();
+}
+
+ReadNodePtr SkipNode::Array()
+{
+	return std::make_unique<SkipNode>();
+}
+
+ObjectNode::ObjectNode(const std::span<const std::string_view> members) : m_member(NoMember), m_members(members), m_present(0)
+{
+}
+
+void ObjectNode::Key(const std::string& key)
+{
+	const auto member(std::find(m_members.begin(), m_members.end(), key));
+	if (member == m_members.end())
+	{
+		m_member = NoMember;
+		return;
+	}
+	m_member = static_cast<size_t>(std::distance(m_members.begin(), member));
+	if (Has(m_member))
+	{
+		Reject("duplicate member");
+	}
+	m_present |= 1ULL << m_member;
+}
+
+ReadNodePtr ObjectNode::Object()
+{
+	return m_member == NoMember ? std::make_unique<SkipNode>() : MemberObject();
+}
+
+ReadNodePtr ObjectNode::Array()
+{
+	return m_member == NoMember ? std::make_unique<SkipNode>() : MemberArray();
+}
+
+void ObjectNode::String(std::string&& value)
+{
+	if (m_member != NoMember)
+	{
+		MemberString(std::move(value));
+	}
+}
+
+void ObjectNode::Boolean(const bool value)
+{
+	if (m_member != NoMember)
+	{
+		MemberBoolean(value);
+	}
+}
+
+void ObjectNode::Integer(const long long value)
+{
+	if (m_member != NoMember)
+	{
+		MemberInteger(value);
+	}
+}
+
+void ObjectNode::Other()
+{
+	if (m_member != NoMember)
+	{
+		WrongType("null or number");
+	}
+}
+
+ReadNodePtr ObjectNode::MemberObject()
+{
+	WrongType("object");
+}
+
+ReadNodePtr ObjectNode::MemberArray()
+{
+	WrongType("array");
+}
+
+void ObjectNode::MemberString(std::string&&)
+{
+	WrongType("string");
+}
+
+void ObjectNode::MemberBoolean(const bool)
+{
+	WrongType("boolean");
+}
+
+void ObjectNode::MemberInteger(const long long)
+{
+	WrongType("integer");
+}
+
+void ObjectNode::Require(const size_t member) const
+{
+	if (!Has(member))
+	{
+		Reject("required member '" + std::string(m_members[member]) + "' is missing");
+	}
+}
+
+void ObjectNode::WrongType(const char* typeName) const
+{
+	Reject(std::string("member '") + std::string(m_members[m_member]) + "' cannot be " + typeName);
+}
+
+void CheckItemCount(const size_t count, const size_t minItems, const size_t maxItems)
+{
+	if (count < minItems)
+	{
+		ReadNode::Reject("array has " + std::to_string(count) + " items, fewer than " + std::to_string(minItems));
+	}
+	if (count > maxItems)
+	{
+		ReadNode::Reject("array has " + std::to_string(count) + " items, more than " + std::to_string(maxItems));
+	}
+}
+
+bool IsFormIDPattern(const std::string& value)
+{
+	// unanchored, as json-schema-validator applies it: any run of 8 hex digits or spaces
+	size_t run(0);
+	for (const char next : value)
+	{
+		if (std::isxdigit(static_cast<unsigned char>(next)) || next == ' ')
+		{
+			if (++run == 8)
+				return true;
+		}
+		else
+		{
+			run = 0;
+		}
+	}
+	return false;
+}
+
+StringListNode::StringListNode(const StringListRule& rule, std::vector<std::string>& target) : m_rule(rule), m_target(target)
+{
+}
+
+void StringListNode::String(std::string&& value)
+{
+	if (!m_rule.m_allowed.empty() && std::find(m_rule.m_allowed.begin(), m_rule.m_allowed.end(), value) == m_rule.m_allowed.end())
+	{
+		Reject("'" + value + "' is not an allowed value");
+	}
+	if (m_rule.m_isFormID && !IsFormIDPattern(value))
+	{
+		Reject("'" + value + "' does not match pattern [0-9 a-f A-F]{8}");
+	}
+	m_target.push_back(std::move(value));
+}
+
+void StringListNode::End()
+{
+	CheckItemCount(m_target.size(), m_rule.m_minItems, m_rule.m_maxItems);
+	if (m_rule.m_uniqueItems)
+	{
+		CheckUniqueItems(m_target);
+	}
+}
+
+namespace
+{
+
+constexpr std::string_view FormsMembers[] = { "plugin", "form" };
+constexpr StringListRule FormIDsRule = { 1, 16, true, {}, true };
+
+class FormsNode : public ObjectNode {
+public:
+	FormsNode(std::pair<std::string, std::vector<std::string>>& target) : ObjectNode(FormsMembers), m_target(target) {}
+
+	virtual ReadNodePtr MemberArray() override
+	{
+		if (m_member != Form)
+			return ObjectNode::MemberArray();
+		return std::make_unique<StringListNode>(FormIDsRule, m_target.second);
+	}
+	virtual void MemberString(std::string&& value) override
+	{
+		if (m_member != Plugin)
+			return ObjectNode::MemberString(std::move(value));
+		m_target.first = std::move(value);
+	}
+	virtual void End() override
+	{
+		Require(Plugin);
+		Require(Form);
+	}
+
+private:
+	enum Member : size_t { Plugin, Form };
+	std::pair<std::string, std::vector<std::string>>& m_target;
+};
+
+}
+
+FormsListNode::FormsListNode(const size_t minItems, const size_t maxItems, const bool uniqueItems, FormsDefinition& target) :
+	m_minItems(minItems), m_maxItems(maxItems), m_uniqueItems(uniqueItems), m_target(target)
+{
+}
+
+ReadNodePtr FormsListNode::Object()
+{
+	return std::make_unique<FormsNode>(m_target.emplace_back());
+}
+
+void FormsListNode::End()
+{
+	CheckItemCount(m_target.size(), m_minItems, m_maxItems);
+	if (m_uniqueItems)
+	{
+		CheckUniqueItems(m_target);
+	}
+}
+
+namespace
+{
+
+// Routes SAX events to the node for the innermost open container and tracks the JSON Pointer of the current token
+class DefinitionSax : public nlohmann::json_sax<nlohmann::json>
+{
+public:
+	DefinitionSax(ReadNodePtr root) : m_root(std::move(root)), m_closing(false) {}
+
+	std::string Path() const
+	{
+		std::string path;
+		// a container being closed is located by the frames below it
+		const size_t located(m_closing ? m_stack.size() - 1 : m_stack.size());
+		for (size_t frame = 0; frame < located; ++frame)
+		{
+			path.push_back('/');
+			if (m_stack[frame].m_isArray)
+			{
+				path.append(std::to_string(m_stack[frame].m_index));
+				continue;
+			}
+			for (const char next : m_stack[frame].m_key)
+			{
+				if (next == '~')
+					path.append("~0");
+				else if (next == '/')
+					path.append("~1");
+				else
+					path.push_back(next);
+			}
+		}
+		return path;
+	}
+
+	virtual bool null() override
+	{
+		Top().Other();
+		return Next();
+	}
+	virtual bool boolean(bool value) override
+	{
+		Top().Boolean(value);
+		return Next();
+	}
+	virtual bool number_integer(number_integer_t value) override
+	{
+		Top().Integer(value);
+		return Next();
+	}
+	virtual bool number_unsigned(number_unsigned_t value) override
+	{
+		if (value > static_cast<number_unsigned_t>(LLONG_MAX))
+		{
+			Top().Other();
+		}
+		else
+		{
+			Top().Integer(static_cast<long long>(value));
+		}
+		return Next();
+	}
+	virtual bool number_float(number_float_t, const string_t&) override
+	{
+		Top().Other();
+		return Next();
+	}
+	virtual bool string(string_t& value) override
+	{
+		Top().String(std::move(value));
+		return Next();
+	}
+	virtual bool binary(binary_t&) override
+	{
+		Top().Other();
+		return Next();
+	}
+	virtual bool start_object(std::size_t) override
+	{
+		if (m_stack.empty())
+		{
+			m_stack.push_back({ std::move(m_root), false, std::string(), 0 });
+			return true;
+		}
+		m_stack.push_back({ Top().Object(), false, std::string(), 0 });
+		return true;
+	}
+	virtual bool key(string_t& key) override
+	{
+		m_stack.back().m_key = key;
+		m_stack.back().m_node->Key(key);
+		return true;
+	}
+	virtual bool end_object() override
+	{
+		return Close();
+	}
+	virtual bool start_array(std::size_t) override
+	{
+		m_stack.push_back({ Top().Array(), true, std::string(), 0 });
+		return true;
+	}
+	virtual bool end_array() override
+	{
+		return Close();
+	}
+	virtual bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& exc) override
+	{
+		throw DefinitionError(Path(), exc.what());
+	}
+
+private:
+	struct Frame {
+		ReadNodePtr m_node;
+		bool m_isArray;
+		// member or item being read
+		std::string m_key;
+		size_t m_index;
+	};
+
+	ReadNode& Top()
+	{
+		if (m_stack.empty())
+		{
+			ReadNode::Reject("top-level value must be an object");
+		}
+		return *m_stack.back().m_node;
+	}
+
+	bool Next()
+	{
+		if (!m_stack.empty() && m_stack.back().m_isArray)
+		{
+			++m_stack.back().m_index;
+		}
+		return true;
+	}
+
+	bool Close()
+	{
+		m_closing = true;
+		m_stack.back().m_node->End();
+		m_closing = false;
+		m_stack.pop_back();
+		return Next();
+	}
+
+	ReadNodePtr m_root;
+	std::vector<Frame> m_stack;
+	bool m_closing;
+};
+
+}
+
+void ReadDefinition(const std::string& text, ReadNodePtr root)
+{
+	DefinitionSax sax(std::move(root));
+	try {
+		nlohmann::json::sax_parse(text, &sax);
+	}
+	catch (const ReadNode::Rejected& rejected) {
+		throw DefinitionError(sax.Path(), rejected.m_reason);
+	}
+}
+
+}
@@ -0,0 +1,177 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace shse
+{
+
+// Definition file that is not well-formed JSON or breaks a rule of its schema. The message leads with the
+// JSON Pointer of the offending value, as json-schema-validator reports it.
+class DefinitionError : public std::runtime_error
+{
+	static constexpr std::string_view ErrorName = "DefinitionError: ";
+public:
+	DefinitionError(const std::string& path, const std::string& reason);
+};
+
+// plugin name with the FormIDs it defines, one entry per schema formsType
+typedef std::vector<std::pair<std::string, std::vector<std::string>>> FormsDefinition;
+
+// Building blocks for single-pass definition readers. nlohmann SAX events are routed to a stack of nodes, one per
+// open JSON container, each checking its value against the schema as the tokens arrive and handing the result on
+// when its container closes. No DOM is built. Nodes report a schema violation with Reject, which the reader turns
+// into a DefinitionError located at the current token.
+class ReadNode;
+typedef std::unique_ptr<ReadNode> ReadNodePtr;
+
+class ReadNode {
+public:
+	struct Rejected {
+		std::string m_reason;
+	};
+
+	virtual ~ReadNode() = default;
+	virtual void Key(const std::string& key);
+	// container starting inside this one, read by the returned node
+	virtual ReadNodePtr Object();
+	virtual ReadNodePtr Array();
+	virtual void String(std::string&& value);
+	virtual void Boolean(const bool value);
+	virtual void Integer(const long long value);
+	// null, floating point or binary
+	virtual void Other();
+	// container closed: check what was read and pass it on
+	virtual void End();
+
+	[[noreturn]] static void Reject(const std::string& reason);
+};
+
+// accepts and discards any value, for members the schema does not define
+class SkipNode : public ReadNode {
+public:
+	virtual ReadNodePtr Object() override;
+	virtual ReadNodePtr Array() override;
+	virtual void String(std::string&&) override {}
+	virtual void Boolean(const bool) override {}
+	virtual void Integer(const long long) override {}
+	virtual void Other() override {}
+	virtual void End() override {}
+};
+
+// Object with a fixed set of named members. Members outside the set are skipped, as the schemas allow them.
+// A repeated member is rejected: the DOM would silently keep the last value.
+class ObjectNode : public ReadNode {
+public:
+	virtual void Key(const std::string& key) override final;
+	virtual ReadNodePtr Object() override final;
+	virtual ReadNodePtr Array() override final;
+	virtual void String(std::string&& value) override final;
+	virtual void Boolean(const bool value) override final;
+	virtual void Integer(const long long value) override final;
+	virtual void Other() override final;
+
+protected:
+	static constexpr size_t NoMember = ~size_t(0);
+
+	ObjectNode(const std::span<const std::string_view> members);
+	// value of the current member, m_member indexes the member names. Default rejects the type.
+	virtual ReadNodePtr MemberObject();
+	virtual ReadNodePtr MemberArray();
+	virtual void MemberString(std::string&& value);
+	virtual void MemberBoolean(const bool value);
+	virtual void MemberInteger(const long long value);
+
+	inline bool Has(const size_t member) const { return (m_present & (1ULL << member)) != 0; }
+	void Require(const size_t member) const;
+
+	size_t m_member;
+
+private:
+	[[noreturn]] void WrongType(const char* typeName) const;
+
+	const std::span<const std::string_view> m_members;
+	unsigned long long m_present;
+};
+
+struct StringListRule {
+	size_t m_minItems;
+	size_t m_maxItems;
+	bool m_uniqueItems;
+	// if not empty, every item must be one of these
+	std::span<const std::string_view> m_allowed;
+	// every item must match schema pattern [0-9 a-f A-F]{8}
+	bool m_isFormID;
+};
+
+// array of strings, stored to the target as read
+class StringListNode : public ReadNode {
+public:
+	StringListNode(const StringListRule& rule, std::vector<std::string>& target);
+	virtual void String(std::string&& value) override;
+	virtual void End() override;
+
+private:
+	const StringListRule& m_rule;
+	std::vector<std::string>& m_target;
+};
+
+// array of schema formsType objects
+class FormsListNode : public ReadNode {
+public:
+	FormsListNode(const size_t minItems, const size_t maxItems, const bool uniqueItems, FormsDefinition& target);
+	virtual ReadNodePtr Object() override;
+	virtual void End() override;
+
+private:
+	const size_t m_minItems;
+	const size_t m_maxItems;
+	const bool m_uniqueItems;
+	FormsDefinition& m_target;
+};
+
+// checks for schema minItems/maxItems/uniqueItems, shared by the list nodes
+void CheckItemCount(const size_t count, const size_t minItems, const size_t maxItems);
+template <typename T> void CheckUniqueItems(const std::vector<T>& items)
+{
+	// lists are capped at a few dozen entries by the schemas
+	for (auto item = items.cbegin(); item != items.cend(); ++item)
+	{
+		if (std::find(std::next(item), items.cend(), *item) != items.cend())
+		{
+			ReadNode::Reject("array items are not unique");
+		}
+	}
+}
+bool IsFormIDPattern(const std::string& value);
+
+// Parse the text as JSON into the given node, which reads the top-level object. Throws DefinitionError on a syntax or
+// schema error.
+void ReadDefinition(const std::string& text, ReadNodePtr root);
+
+}
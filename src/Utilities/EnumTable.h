@@ -0,0 +1,168 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#pragma once
+
+#include <array>
+#include <string_view>
+
+// Compile-time enum <-> name tables. Each table is a constexpr array declared next to its enum and validated by
+// static_assert, so conversions need no map construction during static initialization and a missing, duplicated or
+// misordered entry fails the build instead of falling through to a default at runtime.
+namespace EnumUtils
+{
+	template <typename E>
+	struct EnumName
+	{
+		E value;
+		std::string_view name;
+	};
+
+	template <typename E, size_t N>
+	using EnumNameTable = std::array<EnumName<E>, N>;
+
+	constexpr char ToLowerASCII(const char c)
+	{
+		return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+	}
+
+	constexpr int CompareNames(const std::string_view lhs, const std::string_view rhs, const bool ignoreCase)
+	{
+		const size_t common(lhs.length() < rhs.length() ? lhs.length() : rhs.length());
+		for (size_t index = 0; index < common; ++index)
+		{
+			const char left(ignoreCase ? ToLowerASCII(lhs[index]) : lhs[index]);
+			const char right(ignoreCase ? ToLowerASCII(rhs[index]) : rhs[index]);
+			if (left != right)
+				return left < right ? -1 : 1;
+		}
+		return lhs.length() == rhs.length() ? 0 : (lhs.length() < rhs.length() ? -1 : 1);
+	}
+
+	// entry N has enum value N for every entry, so every value in [0, N) has exactly one name and lookup by value is an
+	// array index
+	template <typename E, size_t N>
+	constexpr bool IsDense(const EnumNameTable<E, N>& table)
+	{
+		for (size_t index = 0; index < N; ++index)
+		{
+			if (static_cast<size_t>(table[index].value) != index)
+				return false;
+		}
+		return true;
+	}
+
+	template <typename E, size_t N>
+	constexpr bool HasUniqueEntries(const EnumNameTable<E, N>& table)
+	{
+		for (size_t index = 0; index < N; ++index)
+		{
+			for (size_t other = index + 1; other < N; ++other)
+			{
+				if (table[index].value == table[other].value || table[index].name == table[other].name)
+					return false;
+			}
+		}
+		return true;
+	}
+
+	// required for tables searched ignoring case, so that sorted order is the same with or without case folding
+	template <typename E, size_t N>
+	constexpr bool IsLowerCase(const EnumNameTable<E, N>& table)
+	{
+		for (const auto& entry : table)
+		{
+			for (const char c : entry.name)
+			{
+				if (c != ToLowerASCII(c))
+					return false;
+			}
+		}
+		return true;
+	}
+
+	template <typename E, size_t N>
+	constexpr bool IsSortedByName(const EnumNameTable<E, N>& table)
+	{
+		for (size_t index = 1; index < N; ++index)
+		{
+			if (CompareNames(table[index - 1].name, table[index].name, false) >= 0)
+				return false;
+		}
+		return true;
+	}
+
+	// copy of a value-ordered table ordered by name for binary search - tables are short and this runs in the compiler
+	template <typename E, size_t N>
+	constexpr EnumNameTable<E, N> SortedByName(EnumNameTable<E, N> table)
+	{
+		for (size_t index = 1; index < N; ++index)
+		{
+			for (size_t slot = index; slot > 0 && CompareNames(table[slot].name, table[slot - 1].name, false) < 0; --slot)
+			{
+				const EnumName<E> moved(table[slot]);
+				table[slot] = table[slot - 1];
+				table[slot - 1] = moved;
+			}
+		}
+		return table;
+	}
+
+	// table must satisfy IsSortedByName, and IsLowerCase if ignoreCase is set
+	template <typename E, size_t N>
+	constexpr const EnumName<E>* FindByName(const EnumNameTable<E, N>& table, const std::string_view name,
+		const bool ignoreCase = false)
+	{
+		size_t low(0);
+		size_t high(N);
+		while (low < high)
+		{
+			const size_t middle(low + (high - low) / 2);
+			if (CompareNames(table[middle].name, name, ignoreCase) < 0)
+			{
+				low = middle + 1;
+			}
+			else
+			{
+				high = middle;
+			}
+		}
+		return (low < N && CompareNames(table[low].name, name, ignoreCase) == 0) ? &table[low] : nullptr;
+	}
+
+	// for sparse enums such as RE::FormType - short linear scan
+	template <typename E, size_t N>
+	constexpr const EnumName<E>* FindByValue(const EnumNameTable<E, N>& table, const E value)
+	{
+		for (const auto& entry : table)
+		{
+			if (entry.value == value)
+				return &entry;
+		}
+		return nullptr;
+	}
+
+	// table must satisfy IsDense
+	template <typename E, size_t N>
+	constexpr std::string_view NameOf(const EnumNameTable<E, N>& table, const E value, const std::string_view fallback)
+	{
+		const size_t index(static_cast<size_t>(value));
+		return index < N ? table[index].name : fallback;
+	}
+}
@@ -23,74 +23,77 @@ http://www.fsf.org/licensing/licenses
 namespace shse
 {
 
+// indexed by Lootability, names are used in logs and diagnostics so some differ from the enumerator
+constexpr EnumUtils::EnumNameTable<Lootability, size_t(Lootability::MAX)> lootabilityNames = {{
+	{Lootability::Lootable, "Lootable"},
+	{Lootability::BaseObjectBlocked, "BaseObjectBlocked"},
+	{Lootability::CannotRelootFirehoseSource, "CannotRelootFirehoseSource"},
+	{Lootability::ContainerPermanentlyOffLimits, "ContainerPermanentlyOffLimits"},
+	{Lootability::CorruptArrowPosition, "CorruptArrowPosition"},
+	{Lootability::CannotMineTwiceInSameCellVisit, "CannotMineTwiceInSameCellVisit"},
+	{Lootability::ReferenceBlacklisted, "ReferenceBlacklisted"},
+	{Lootability::UnnamedReference, "UnnamedReference"},
+	{Lootability::ReferenceIsPlayer, "ReferenceIsPlayer"},
+	{Lootability::ReferenceIsLiveActor, "ReferenceIsLiveActor"},
+	{Lootability::FloraHarvested, "FloraHarvested"},
+	{Lootability::PendingHarvest, "PendingHarvest"},
+	{Lootability::ContainerLootedAlready, "ContainerLootedAlready"},
+	{Lootability::DynamicReferenceLootedAlready, "DynamicReferenceLootedAlready"},
+	{Lootability::NullReference, "NullReference"},
+	{Lootability::InvalidFormID, "InvalidFormID"},
+	{Lootability::NoBaseObject, "NoBaseObject"},
+	{Lootability::LootDeadBodyDisabled, "LootDeadBodyDisabled"},
+	{Lootability::DeadBodyIsPlayerAlly, "DeadBodyIsPlayerAlly"},
+	{Lootability::DeadBodyIsSummoned, "DeadBodyIsSummoned"},
+	{Lootability::DeadBodyIsEssential, "DeadBodyIsEssential"},
+	{Lootability::DeadBodyDelayedLooting, "DeadBodyDelayedLooting"},
+	{Lootability::DeadBodyPossibleDuplicate, "DeadBodyPossibleDuplicate"},
+	{Lootability::LootContainersDisabled, "LootContainersDisabled"},
+	{Lootability::HarvestLooseItemDisabled, "HarvestLooseItemDisabled"},
+	{Lootability::PendingProducerIngredient, "PendingProducerIngredient"},
+	{Lootability::ObjectTypeUnknown, "ObjectTypeUnknown"},
+	{Lootability::ManualLootTarget, "ManualLootTarget"},
+	{Lootability::BaseObjectOnBlacklist, "BaseObjectOnBlacklist"},
+	{Lootability::CannotLootQuestTarget, "CannotLootQuestTarget"},
+	{Lootability::ObjectIsInBlacklistCollection, "ObjectIsInBlacklistCollection"},
+	{Lootability::CannotLootValuableObject, "CannotLootValuableObject"},
+	{Lootability::CannotLootEnchantedObject, "CannotLootEnchantedObject"},
+	{Lootability::CannotLootAmmo, "CannotLootAmmo"},
+	{Lootability::PlayerOwned, "PlayerOwned"},
+	{Lootability::CrimeToLoot, "CrimeToLoot"},
+	{Lootability::CellOrItemOwnerPreventsOwnerlessLooting, "CellOrItemOwnerPreventsOwnerlessLooting"},
+	{Lootability::PopulousLocationRestrictsLooting, "PopulousLocationRestrictsLooting"},
+	{Lootability::ItemInBlacklistCollection, "ItemOnBlacklistCollection"},
+	{Lootability::CollectibleItemSetToGlow, "CollectibleItemSetToGlow"},
+	{Lootability::LawAbidingSoNoWhitelistItemLooting, "CrimeCheckPreventsWhitelistItemLooting"},
+	{Lootability::ItemIsBlacklisted, "ItemIsBlacklisted"},
+	{Lootability::ItemTypeIsSetToPreventLooting, "ItemTypeIsSetToPreventLooting"},
+	{Lootability::HarvestDisallowedForBaseObjectType, "HarvestDisallowedForBaseObjectType"},
+	{Lootability::ValueWeightPreventsLooting, "ValueWeightPreventsLooting"},
+	{Lootability::ItemTheftTriggered, "ItemTheftTriggered"},
+	{Lootability::HarvestOperationPending, "HarvestOperationPending"},
+	{Lootability::ContainerHasNoLootableItems, "ContainerHasNoLootableItems"},
+	{Lootability::ContainerIsLocked, "ContainerIsLocked"},
+	{Lootability::ContainerIsBossChest, "ContainerIsBossChest"},
+	{Lootability::ContainerHasQuestObject, "ContainerHasQuestObject"},
+	{Lootability::ContainerHasValuableObject, "ContainerHasValuableObject"},
+	{Lootability::ContainerHasEnchantedObject, "ContainerHasEnchantedObject"},
+	{Lootability::ReferencesBlacklistedContainer, "ReferencesBlacklistedContainer"},
+	{Lootability::CannotGetAshPile, "CannotGetAshPile"},
+	{Lootability::ProducerHasNoLootable, "ProducerHasNoLootable"},
+	{Lootability::ContainerBlacklistedByUser, "ContainerBlacklistedByUser"},
+	{Lootability::DeadBodyBlacklistedByUser, "DeadBodyBlacklistedByUser"},
+	{Lootability::NPCExcludedByDeadBodyFilter, "NPCExcludedByDeadBodyFilter"},
+	{Lootability::NPCIsInBlacklistCollection, "NPCIsInBlacklistCollection"},
+	{Lootability::ContainerIsLootTransferTarget, "ContainerIsLootTransferTarget"},
+	{Lootability::InventoryLimitsEnforced, "InventoryLimitsEnforced"},
+	{Lootability::OutOfScope, "OutOfScope"}
+}};
+static_assert(EnumUtils::IsDense(lootabilityNames) && EnumUtils::HasUniqueEntries(lootabilityNames));
+
 std::string LootabilityName(const Lootability lootability)
 {
-	switch (lootability) {
-	case Lootability::Lootable: return "Lootable";
-	case Lootability::BaseObjectBlocked : return "BaseObjectBlocked";
-	case Lootability::CannotRelootFirehoseSource: return "CannotRelootFirehoseSource";
-	case Lootability::ContainerPermanentlyOffLimits: return "ContainerPermanentlyOffLimits";
-	case Lootability::CorruptArrowPosition: return "CorruptArrowPosition";
-	case Lootability::CannotMineTwiceInSameCellVisit: return "CannotMineTwiceInSameCellVisit";
-	case Lootability::ReferenceBlacklisted : return "ReferenceBlacklisted";
-	case Lootability::UnnamedReference : return "UnnamedReference";
-	case Lootability::ReferenceIsPlayer : return "ReferenceIsPlayer";
-	case Lootability::ReferenceIsLiveActor : return "ReferenceIsLiveActor";
-	case Lootability::FloraHarvested : return "FloraHarvested";
-	case Lootability::PendingHarvest : return "PendingHarvest";
-	case Lootability::ContainerLootedAlready : return "ContainerLootedAlready";
-	case Lootability::DynamicReferenceLootedAlready : return "DynamicReferenceLootedAlready";
-	case Lootability::NullReference : return "NullReference";
-	case Lootability::InvalidFormID : return "InvalidFormID";
-	case Lootability::NoBaseObject : return "NoBaseObject";
-	case Lootability::LootDeadBodyDisabled : return "LootDeadBodyDisabled";
-	case Lootability::DeadBodyIsPlayerAlly : return "DeadBodyIsPlayerAlly";
-	case Lootability::DeadBodyIsSummoned: return "DeadBodyIsSummoned";
-	case Lootability::DeadBodyIsEssential: return "DeadBodyIsEssential";
-	case Lootability::DeadBodyDelayedLooting : return "DeadBodyDelayedLooting";
-	case Lootability::DeadBodyPossibleDuplicate : return "DeadBodyPossibleDuplicate";
-	case Lootability::LootContainersDisabled : return "LootContainersDisabled";
-	case Lootability::HarvestLooseItemDisabled : return "HarvestLooseItemDisabled";
-	case Lootability::PendingProducerIngredient : return "PendingProducerIngredient";
-	case Lootability::ObjectTypeUnknown : return "ObjectTypeUnknown";
-	case Lootability::ManualLootTarget : return "ManualLootTarget";
-	case Lootability::BaseObjectOnBlacklist : return "BaseObjectOnBlacklist";
-	case Lootability::CannotLootQuestTarget : return "CannotLootQuestTarget";
-	case Lootability::ObjectIsInBlacklistCollection : return "ObjectIsInBlacklistCollection";
-	case Lootability::CannotLootValuableObject : return "CannotLootValuableObject";
-	case Lootability::CannotLootEnchantedObject: return "CannotLootEnchantedObject";
-	case Lootability::CannotLootAmmo : return "CannotLootAmmo";
-	case Lootability::PlayerOwned : return "PlayerOwned";
-	case Lootability::CrimeToLoot : return "CrimeToLoot";
-	case Lootability::CellOrItemOwnerPreventsOwnerlessLooting: return "CellOrItemOwnerPreventsOwnerlessLooting";
-	case Lootability::PopulousLocationRestrictsLooting : return "PopulousLocationRestrictsLooting";
-	case Lootability::ItemInBlacklistCollection : return "ItemOnBlacklistCollection";
-	case Lootability::CollectibleItemSetToGlow : return "CollectibleItemSetToGlow";
-	case Lootability::LawAbidingSoNoWhitelistItemLooting : return "CrimeCheckPreventsWhitelistItemLooting";
-	case Lootability::ItemIsBlacklisted : return "ItemIsBlacklisted";
-	case Lootability::ItemTypeIsSetToPreventLooting : return "ItemTypeIsSetToPreventLooting";
-	case Lootability::HarvestDisallowedForBaseObjectType: return "HarvestDisallowedForBaseObjectType";
-	case Lootability::ValueWeightPreventsLooting : return "ValueWeightPreventsLooting";
-	case Lootability::ItemTheftTriggered : return "ItemTheftTriggered";
-	case Lootability::HarvestOperationPending : return "HarvestOperationPending";
-	case Lootability::ContainerHasNoLootableItems : return "ContainerHasNoLootableItems";
-	case Lootability::ContainerIsLocked : return "ContainerIsLocked";
-	case Lootability::ContainerIsBossChest : return "ContainerIsBossChest";
-	case Lootability::ContainerHasQuestObject : return "ContainerHasQuestObject";
-	case Lootability::ContainerHasValuableObject : return "ContainerHasValuableObject";
-	case Lootability::ContainerHasEnchantedObject: return "ContainerHasEnchantedObject";
-	case Lootability::ReferencesBlacklistedContainer : return "ReferencesBlacklistedContainer";
-	case Lootability::CannotGetAshPile: return "CannotGetAshPile";
-	case Lootability::ProducerHasNoLootable: return "ProducerHasNoLootable";
-	case Lootability::ContainerBlacklistedByUser: return "ContainerBlacklistedByUser";
-	case Lootability::DeadBodyBlacklistedByUser: return "DeadBodyBlacklistedByUser";
-	case Lootability::NPCExcludedByDeadBodyFilter: return "NPCExcludedByDeadBodyFilter";
-	case Lootability::NPCIsInBlacklistCollection: return "NPCIsInBlacklistCollection";
-	case Lootability::ContainerIsLootTransferTarget: return "ContainerIsLootTransferTarget";
-	case Lootability::InventoryLimitsEnforced: return "InventoryLimitsEnforced";
-	case Lootability::OutOfScope: return "OutOfScope";
-	default: return "";
-	}
+	return std::string(EnumUtils::NameOf(lootabilityNames, lootability, ""));
 }
 
 }
\ No newline at end of file
@@ -206,30 +206,24 @@ inline bool CollectibleHistoryNeeded(const CollectibleHandling collectibleHandli
 	return collectibleHandling == CollectibleHandling::Take || collectibleHandling == CollectibleHandling::Glow;
 }
 
+constexpr EnumUtils::EnumNameTable<CollectibleHandling, size_t(CollectibleHandling::MAX)> CollectibleHandlingNames = {{
+	{CollectibleHandling::Leave, "leave"},
+	{CollectibleHandling::Take, "take"},
+	{CollectibleHandling::Glow, "glow"},
+	{CollectibleHandling::Print, "print"}
+}};
+static_assert(EnumUtils::IsDense(CollectibleHandlingNames) && EnumUtils::HasUniqueEntries(CollectibleHandlingNames));
+constexpr auto CollectibleHandlingByName(EnumUtils::SortedByName(CollectibleHandlingNames));
+
 inline std::string CollectibleHandlingString(const CollectibleHandling collectibleHandling)
 {
-	switch (collectibleHandling) {
-	case CollectibleHandling::Take:
-		return "take";
-	case CollectibleHandling::Glow:
-		return "glow";
-	case CollectibleHandling::Print:
-		return "print";
-	case CollectibleHandling::Leave:
-	default:
-		return "leave";
-	}
+	return std::string(EnumUtils::NameOf(CollectibleHandlingNames, collectibleHandling, "leave"));
 }
 
 inline CollectibleHandling ParseCollectibleHandling(const std::string& action)
 {
-	if (action == "take")
-		return CollectibleHandling::Take;
-	if (action == "glow")
-		return CollectibleHandling::Glow;
-	if (action == "print")
-		return CollectibleHandling::Print;
-	return CollectibleHandling::Leave;
+	const auto matched(EnumUtils::FindByName(CollectibleHandlingByName, action));
+	return matched ? matched->value : CollectibleHandling::Leave;
 }
 
 inline CollectibleHandling CollectibleHandlingFromIniSetting(const double iniSetting)
@@ -359,6 +353,14 @@ inline std::string CompassDirectionName(const CompassDirection direction)
 	}
 }
 
+// restrict a query over places by whether the player has been there
+enum class VisitedFilter {
+	Any = 0,
+	Visited,
+	Unvisited,
+	MAX
+};
+
 enum class OwnershipRule {
 	AllowCrimeIfUndetected = 0,
 	DisallowCrime,
@@ -0,0 +1,191 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#include "PrecompiledHeaders.h"
+
+#include "Utilities/KDTree.h"
+
+namespace shse
+{
+
+KDTree::KDTree()
+{
+}
+
+void KDTree::Build(const std::vector<std::pair<Point, Tag>>& points)
+{
+	m_nodes.clear();
+	m_nodes.reserve(points.size());
+	for (const auto& point : points)
+	{
+		m_nodes.push_back({ point.first, point.second, 0 });
+	}
+	BuildRange(0, m_nodes.size());
+}
+
+void KDTree::Clear()
+{
+	m_nodes.clear();
+}
+
+void KDTree::BuildRange(const size_t begin, const size_t end)
+{
+	if (end - begin < 2)
+		return;
+	// split on the axis with the widest spread of coordinates in this subrange
+	Point low(m_nodes[begin].m_point);
+	Point high(low);
+	for (size_t index = begin + 1; index < end; ++index)
+	{
+		for (size_t axis = 0; axis < 3; ++axis)
+		{
+			low[axis] = std::min(low[axis], m_nodes[index].m_point[axis]);
+			high[axis] = std::max(high[axis], m_nodes[index].m_point[axis]);
+		}
+	}
+	uint8_t axis(0);
+	for (uint8_t candidate = 1; candidate < 3; ++candidate)
+	{
+		if (high[candidate] - low[candidate] > high[axis] - low[axis])
+		{
+			axis = candidate;
+		}
+	}
+	const size_t middle(begin + (end - begin) / 2);
+	std::nth_element(m_nodes.begin() + begin, m_nodes.begin() + middle, m_nodes.begin() + end,
+		[=](const Node& lhs, const Node& rhs) -> bool { return lhs.m_point[axis] < rhs.m_point[axis]; });
+	m_nodes[middle].m_axis = axis;
+	BuildRange(begin, middle);
+	BuildRange(middle + 1, end);
+}
+
+float KDTree::DistanceSquared(const Point& lhs, const Point& rhs)
+{
+	const float dx(lhs[0] - rhs[0]);
+	const float dy(lhs[1] - rhs[1]);
+	const float dz(lhs[2] - rhs[2]);
+	return (dx * dx) + (dy * dy) + (dz * dz);
+}
+
+std::optional<KDTree::Neighbour> KDTree::Nearest(const Point& query) const
+{
+	std::vector<Neighbour> nearest(KNearest(query, 1));
+	if (nearest.empty())
+		return std::nullopt;
+	return nearest.front();
+}
+
+std::vector<KDTree::Neighbour> KDTree::KNearest(const Point& query, const size_t k) const
+{
+	if (k == 0)
+		return {};
+	std::vector<Candidate> best;
+	best.reserve(std::min(k, m_nodes.size()) + 1);
+	SearchKNearest(0, m_nodes.size(), query, k, nullptr, best);
+	return ToNeighbours(best);
+}
+
+std::vector<KDTree::Neighbour> KDTree::KNearest(const Point& query, const size_t k, const Filter& accept) const
+{
+	if (k == 0)
+		return {};
+	std::vector<Candidate> best;
+	best.reserve(std::min(k, m_nodes.size()) + 1);
+	SearchKNearest(0, m_nodes.size(), query, k, accept ? &accept : nullptr, best);
+	return ToNeighbours(best);
+}
+
+std::vector<KDTree::Neighbour> KDTree::WithinRadius(const Point& query, const double radius) const
+{
+	if (radius < 0.)
+		return {};
+	std::vector<Candidate> found;
+	SearchRadius(0, m_nodes.size(), query, static_cast<float>(radius * radius), found);
+	return ToNeighbours(found);
+}
+
+void KDTree::SearchKNearest(const size_t begin, const size_t end, const Point& query, const size_t k,
+	const Filter* accept, std::vector<Candidate>& best) const
+{
+	if (begin >= end)
+		return;
+	const size_t middle(begin + (end - begin) / 2);
+	const Node& node(m_nodes[middle]);
+	const float distance(DistanceSquared(query, node.m_point));
+	if (best.size() < k)
+	{
+		if (!accept || (*accept)(node.m_tag))
+		{
+			best.emplace_back(distance, middle);
+			std::push_heap(best.begin(), best.end());
+		}
+	}
+	else if (distance < best.front().first && (!accept || (*accept)(node.m_tag)))
+	{
+		std::pop_heap(best.begin(), best.end());
+		best.back() = { distance, middle };
+		std::push_heap(best.begin(), best.end());
+	}
+	// descend the side containing the query first, the other only if it could hold a closer point
+	const float offset(query[node.m_axis] - node.m_point[node.m_axis]);
+	const bool lowFirst(offset < 0.f);
+	SearchKNearest(lowFirst ? begin : middle + 1, lowFirst ? middle : end, query, k, accept, best);
+	if (best.size() < k || offset * offset < best.front().first)
+	{
+		SearchKNearest(lowFirst ? middle + 1 : begin, lowFirst ? end : middle, query, k, accept, best);
+	}
+}
+
+void KDTree::SearchRadius(const size_t begin, const size_t end, const Point& query, const float radiusSquared,
+	std::vector<Candidate>& found) const
+{
+	if (begin >= end)
+		return;
+	const size_t middle(begin + (end - begin) / 2);
+	const Node& node(m_nodes[middle]);
+	const float distance(DistanceSquared(query, node.m_point));
+	if (distance <= radiusSquared)
+	{
+		found.emplace_back(distance, middle);
+	}
+	const float offset(query[node.m_axis] - node.m_point[node.m_axis]);
+	if (offset <= 0.f || offset * offset <= radiusSquared)
+	{
+		SearchRadius(begin, middle, query, radiusSquared, found);
+	}
+	if (offset >= 0.f || offset * offset <= radiusSquared)
+	{
+		SearchRadius(middle + 1, end, query, radiusSquared, found);
+	}
+}
+
+std::vector<KDTree::Neighbour> KDTree::ToNeighbours(std::vector<Candidate>& candidates) const
+{
+	std::sort(candidates.begin(), candidates.end());
+	std::vector<Neighbour> neighbours;
+	neighbours.reserve(candidates.size());
+	for (const auto& candidate : candidates)
+	{
+		const Node& node(m_nodes[candidate.second]);
+		neighbours.push_back({ node.m_point, node.m_tag, std::sqrt(static_cast<double>(candidate.first)) });
+	}
+	return neighbours;
+}
+
+}
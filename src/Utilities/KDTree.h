@@ -0,0 +1,78 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#pragma once
+
+namespace shse
+{
+
+// Static 3D k-d tree over tagged points, stored implicitly in one array: each subrange [begin, end) is rooted at its
+// midpoint, split on the axis of widest spread, so no child links are needed and queries walk contiguous memory.
+// Built once per point set, then read-only.
+class KDTree
+{
+public:
+	typedef std::array<float, 3> Point;
+	typedef uint32_t Tag;
+	typedef std::function<bool(const Tag)> Filter;
+
+	struct Neighbour
+	{
+		Point m_point;
+		Tag m_tag;
+		double m_distance;
+	};
+
+	KDTree();
+	void Build(const std::vector<std::pair<Point, Tag>>& points);
+	void Clear();
+	inline size_t Size() const { return m_nodes.size(); }
+	inline bool Empty() const { return m_nodes.empty(); }
+
+	std::optional<Neighbour> Nearest(const Point& query) const;
+	// up to k points, nearest first
+	std::vector<Neighbour> KNearest(const Point& query, const size_t k) const;
+	// up to k points accepted by the filter, nearest first - the filter is consulted during the one traversal, only
+	// for points that would otherwise make the cut
+	std::vector<Neighbour> KNearest(const Point& query, const size_t k, const Filter& accept) const;
+	// all points within radius, nearest first
+	std::vector<Neighbour> WithinRadius(const Point& query, const double radius) const;
+
+private:
+	struct Node
+	{
+		Point m_point;
+		Tag m_tag;
+		uint8_t m_axis;
+	};
+	// candidate by squared distance, ordered for a max-heap on distance
+	typedef std::pair<float, size_t> Candidate;
+
+	void BuildRange(const size_t begin, const size_t end);
+	void SearchKNearest(const size_t begin, const size_t end, const Point& query, const size_t k,
+		const Filter* accept, std::vector<Candidate>& best) const;
+	void SearchRadius(const size_t begin, const size_t end, const Point& query, const float radiusSquared,
+		std::vector<Candidate>& found) const;
+	static float DistanceSquared(const Point& lhs, const Point& rhs);
+	std::vector<Neighbour> ToNeighbours(std::vector<Candidate>& candidates) const;
+
+	std::vector<Node> m_nodes;
+};
+
+}
@@ -20,6 +20,7 @@ http://www.fsf.org/licensing/licenses
 #include "PrecompiledHeaders.h"
 
 #include "Utilities/utils.h"
+#include "Utilities/BrotliStream.h"
 
 #include <shlobj.h>
 #include <psapi.h>
@@ -31,8 +32,6 @@ http://www.fsf.org/licensing/licenses
 #include <math.h>	// pow
 #include <locale>
 
-#include <brotli/decode.h>
-#include <brotli/encode.h>
 
 namespace FileUtils
 {
@@ -264,6 +263,17 @@ namespace StringUtils
 		DBG_VMESSAGE("FormID 0x{:08x} mapped to {}", formID, result.c_str());
 		return result;
 	}
+
+	std::string_view InternedStrings::Intern(const std::string_view str)
+	{
+		auto matched(m_strings.find(str));
+		if (matched == m_strings.cend())
+		{
+			matched = m_strings.emplace(str).first;
+		}
+		// set nodes are stable, so a view of the stored string remains valid on rehash
+		return std::string_view(*matched);
+	}
 }
 
 namespace GameSettingUtils
@@ -278,59 +288,39 @@ namespace GameSettingUtils
 
 namespace CompressionUtils
 {
-	// Encoded data consists of its length (type size_t) followed by the compressed version of the input
+	// Encoded data consists of its length (type size_t) followed by the compressed version of the input. JSON text
+	// streams through the decoder into the parser, so the inflated text is never held in full.
 	bool DecodeBrotli(const std::string& compressed, nlohmann::json& output)
 	{
-		if (compressed.length() < sizeof(size_t))
-		{
-			REL_ERROR("Inflating {} bytes failed, record too short", compressed.length());
-			return false;
+		BrotliInputBuffer inflater(compressed);
+		std::istream inflated(&inflater);
+		try {
+			output = nlohmann::json::parse(inflated);
 		}
-		size_t inputSize(compressed.length());
-		size_t* length(reinterpret_cast<size_t*>(const_cast<char*>(compressed.c_str())));
-		std::string inflated(*length, 0);
-		size_t outputSize;
-		BrotliDecoderResult result(BrotliDecoderDecompress(inputSize, reinterpret_cast<const uint8_t*>(compressed.c_str() + sizeof(size_t)),
-			&outputSize, reinterpret_cast<uint8_t*>(const_cast<char*>(inflated.c_str()))));
-		if (result == BROTLI_DECODER_RESULT_SUCCESS)
-		{
-			REL_MESSAGE("Inflated {} bytes to {} vs size-hint of {}", inputSize, outputSize, *length);
-			inflated.resize(outputSize);
-			try {
-				output = nlohmann::json::parse(inflated);
-				return true;
-			}
-			catch (const std::exception& e) {
-				REL_ERROR("Inflated record not JSON-parsable '{}' etc. not loadable, error:\n{}", inflated.substr(0, 25), e.what());
-				return false;
-			}
+		catch (const std::exception& e) {
+			REL_ERROR("Inflated {} bytes not JSON-parsable, error:\n{}", compressed.length(), e.what());
+			return false;
 		}
-		else
+		if (inflater.Failed())
 		{
-			REL_ERROR("Inflating {} bytes failed, error {}", inputSize, result);
 			return false;
 		}
+		REL_MESSAGE("Inflated {} bytes to {} bytes of JSON", compressed.length(), inflater.PlainLength());
+		return true;
 	}
 
 	bool EncodeBrotli(const nlohmann::json& j, std::string& encoded)
 	{
-		std::string jsonStr(j.dump());
-		size_t outputSize(BrotliEncoderMaxCompressedSize(jsonStr.length()));
-		encoded.resize(outputSize + sizeof(size_t), 0);
-		// write inflated string length at the head of the output
-		size_t* length(reinterpret_cast<size_t*>(const_cast<char*>(encoded.c_str())));
-		*length = jsonStr.length();
-		static constexpr int BrotliQuality(1);	// favour fast speed over small size
-		if (BrotliEncoderCompress(BrotliQuality, BROTLI_DEFAULT_WINDOW, BROTLI_MODE_TEXT,
-			jsonStr.length(), reinterpret_cast<const uint8_t*>(jsonStr.c_str()), &outputSize,
-			reinterpret_cast<uint8_t*>(const_cast<char*>(encoded.c_str() + sizeof(size_t)))) != BROTLI_FALSE)
+		BrotliOutputBuffer compressor(encoded, true);
+		std::ostream plain(&compressor);
+		plain << j;
+		if (!plain.flush() || !compressor.Finish())
 		{
-			REL_MESSAGE("Compressed {} bytes to {}, ratio {:0.3f}", jsonStr.length(), outputSize, double(jsonStr.length()) / double(outputSize));
-			encoded.resize(outputSize + sizeof(size_t));
-			return true;
+			REL_ERROR("Compressing {} bytes of JSON failed", compressor.PlainLength());
+			return false;
 		}
-		REL_ERROR("Compressing {} bytes failed", jsonStr.length());
-		return false;
+		REL_MESSAGE("Compressed {} bytes of JSON to {}", compressor.PlainLength(), encoded.length());
+		return true;
 	}
 }
 
@@ -122,6 +122,25 @@ namespace StringUtils
 
 	}
 	std::string FormIDString(const RE::FormID formID);
+
+	// heterogeneous lookup, so that string_view or const char* probes do not construct a std::string
+	struct TransparentHash
+	{
+		using is_transparent = void;
+		inline size_t operator()(const std::string_view str) const { return std::hash<std::string_view>()(str); }
+	};
+	typedef std::unordered_set<std::string, TransparentHash, std::equal_to<>> TransparentStringSet;
+
+	// Holds one copy of each string in a fixed vocabulary. Returned views are null-terminated and remain valid
+	// for the lifetime of the pool, so they can be used as map keys and values without further allocation.
+	class InternedStrings
+	{
+	public:
+		std::string_view Intern(const std::string_view str);
+		inline size_t Size() const { return m_strings.size(); }
+	private:
+		TransparentStringSet m_strings;
+	};
 }
 
 namespace CompressionUtils
@@ -134,10 +153,10 @@ namespace JSONUtils
 {
 	std::vector<std::pair<std::string, std::vector<std::string>>> ParseFormsType(const nlohmann::json& formsType);
 
-	template <typename FORMTYPE> std::unordered_set<const FORMTYPE*> ToForms(const nlohmann::json& formsType)
+	template <typename FORMTYPE> std::unordered_set<const FORMTYPE*> ToForms(
+		const std::vector<std::pair<std::string, std::vector<std::string>>>& formNamesByPlugin)
 	{
 		std::unordered_set<const FORMTYPE*> forms;
-		const auto formNamesByPlugin(ParseFormsType(formsType));
 		for (const auto& entry : formNamesByPlugin)
 		{
 			for (const auto nextID : entry.second)
@@ -102,6 +102,7 @@ void ActorTracker::RecordTimeOfDeath(RE::TESObjectREFR* refr)
 void ActorTracker::RecordVictim(const PartyVictim& victim)
 {
 	m_victims.push_back(victim);
+	++m_generation;
 	Saga::Instance().AddEvent(m_victims.back());
 }
 
@@ -193,10 +194,12 @@ void ActorTracker::ClearVictims()
 {
 	RecursiveLockGuard guard(m_actorLock);
 	m_victims.clear();
+	++m_generation;
 }
 
 void ActorTracker::AsJSON(nlohmann::json& j) const
 {
+	RecursiveLockGuard guard(m_actorLock);
 	nlohmann::json victims(nlohmann::json::array());
 	for (const auto& victim : m_victims)
 	{
@@ -211,6 +214,7 @@ void ActorTracker::UpdateFrom(const nlohmann::json& j)
 	REL_MESSAGE("Cosave Party Victims\n{}", j.dump(2));
 	RecursiveLockGuard guard(m_actorLock);
 	m_victims.clear();
+	++m_generation;
 	m_victims.reserve(j["victims"].size());
 	for (const nlohmann::json& victim : j["victims"])
 	{
@@ -19,6 +19,8 @@ http://www.fsf.org/licensing/licenses
 *************************************************************************/
 #pragma once
 
+#include <atomic>
+
 #include <deque>
 
 #include "Looting/IRangeChecker.h"
@@ -51,6 +53,8 @@ public:
 	ActorTracker();
 	void AsJSON(nlohmann::json& j) const;
 	void UpdateFrom(const nlohmann::json& j);
+	// advances whenever state saved to the cosave changes
+	inline uint64_t Generation() const { return m_generation; }
 
 	void Reset();
 	void RecordLiveSighting(const RE::TESObjectREFR* actorRef);
@@ -92,6 +96,7 @@ private:
 	std::vector<PartyVictim> m_victims;
 
 	mutable RecursiveLock m_actorLock;
+	std::atomic<uint64_t> m_generation = 0;
 };
 
 void to_json(nlohmann::json& j, const ActorTracker& actorTracker);
@@ -189,7 +189,8 @@ AdventureTargets& AdventureTargets::Instance()
 	return *m_instance;
 }
 
-AdventureTargets::AdventureTargets() : m_targetLocation(nullptr), m_targetWorld(nullptr)
+AdventureTargets::AdventureTargets() : m_unvisitedCountByType{}, m_viewType(AdventureTargetType::MAX),
+	m_targetLocation(nullptr), m_targetWorld(nullptr)
 {
 }
 
@@ -199,9 +200,9 @@ void AdventureTargets::Reset()
 	m_adventureEvents.clear();
 	m_targetLocation = nullptr;
 	m_targetWorld = nullptr;
+	++m_generation;
 
-	m_unvisitedLocationsByWorld.clear();
-	m_sortedWorlds.clear();
+	m_viewType = AdventureTargetType::MAX;
 }
 
 Position AdventureTargets::GetInteriorCellPosition(const RE::TESObjectCELL* cell, const RE::BGSLocation* location) const
@@ -576,6 +577,70 @@ void AdventureTargets::Categorize()
 	}
 	REL_MESSAGE("{} Adventure Targets created from {} unique Locations", targets,
 		RE::TESDataHandler::GetSingleton()->GetFormArray<RE::BGSLocation>().size());
+	IndexUnvisited();
+}
+
+void AdventureTargets::IndexUnvisited()
+{
+	RecursiveLockGuard guard(m_adventureLock);
+	for (size_t adventureType = 0; adventureType < size_t(AdventureTargetType::MAX); ++adventureType)
+	{
+		LocationsByWorld& unvisited(m_unvisitedByType[adventureType]);
+		std::vector<const RE::TESWorldSpace*>& sortedWorlds(m_sortedWorldsByType[adventureType]);
+		unvisited.clear();
+		sortedWorlds.clear();
+		m_unvisitedCountByType[adventureType] = 0;
+		for (const RE::BGSLocation* location : m_locationsByType[adventureType])
+		{
+			if (VisitedPlaces::Instance().IsKnown(location))
+				continue;
+			++m_unvisitedCountByType[adventureType];
+			const auto worldIter(m_worldByLocation.find(location));
+			if (worldIter == m_worldByLocation.cend())
+				continue;
+			auto worldLocations(unvisited.find(worldIter->second));
+			if (worldLocations == unvisited.end())
+			{
+				worldLocations = unvisited.insert({ worldIter->second, {} }).first;
+				sortedWorlds.push_back(worldIter->second);
+			}
+			worldLocations->second.insert(location);
+		}
+		std::sort(sortedWorlds.begin(), sortedWorlds.end(), [=](const RE::TESWorldSpace* lhs, const RE::TESWorldSpace* rhs) -> bool {
+			std::string leftName(lhs->GetName());
+			std::string rightName(rhs->GetName());
+			return std::lexicographical_compare(leftName.cbegin(), leftName.cend(), rightName.cbegin(), rightName.cend());
+		});
+		DBG_MESSAGE("{} unvisited Adventure Targets for type {} in {} worlds", m_unvisitedCountByType[adventureType],
+			AdventureTargetNameByIndex(adventureType), sortedWorlds.size());
+	}
+}
+
+void AdventureTargets::MarkVisited(const RE::BGSLocation* location)
+{
+	RecursiveLockGuard guard(m_adventureLock);
+	const auto worldIter(m_worldByLocation.find(location));
+	for (size_t adventureType = 0; adventureType < size_t(AdventureTargetType::MAX); ++adventureType)
+	{
+		if (!m_locationsByType[adventureType].contains(location) || m_unvisitedCountByType[adventureType] == 0)
+			continue;
+		--m_unvisitedCountByType[adventureType];
+		if (worldIter == m_worldByLocation.cend())
+			continue;
+		LocationsByWorld& unvisited(m_unvisitedByType[adventureType]);
+		auto worldLocations(unvisited.find(worldIter->second));
+		if (worldLocations == unvisited.end() || worldLocations->second.erase(location) == 0)
+			continue;
+		DBG_MESSAGE("Adventure Target {}/0x{:08x} of type {} visited, {} left in WorldSpace {}/0x{:08x}",
+			location->GetName(), location->GetFormID(), AdventureTargetNameByIndex(adventureType),
+			worldLocations->second.size(), worldIter->second->GetName(), worldIter->second->GetFormID());
+		if (worldLocations->second.empty())
+		{
+			// world is no longer viable for this type, name order of the rest is unchanged
+			unvisited.erase(worldLocations);
+			std::erase(m_sortedWorldsByType[adventureType], worldIter->second);
+		}
+	}
 }
 
 std::string AdventureTargets::AdventureTypeName(const size_t adventureType) const
@@ -592,17 +657,13 @@ size_t AdventureTargets::AvailableAdventureTypes() const
 {
 	RecursiveLockGuard guard(m_adventureLock);
 	m_validAdventureTypes.clear();
-	size_t adventureType(0);
-	for (const auto locations : m_locationsByType)
+	for (size_t adventureType = 0; adventureType < size_t(AdventureTargetType::MAX); ++adventureType)
 	{
-		if (std::find_if(locations.cbegin(), locations.cend(), [=](const RE::BGSLocation* location) -> bool	{
-				return !VisitedPlaces::Instance().IsKnown(location);
-			}) != locations.cend())
+		if (m_unvisitedCountByType[adventureType] > 0)
 		{
 			// establish mapping between MCM index and original adventure type if there are unknown locations for this type
 			m_validAdventureTypes.push_back(AdventureTargetType(adventureType));
 		}
-        ++adventureType;
 	}
 	return m_validAdventureTypes.size();
 }
@@ -639,51 +700,29 @@ std::unordered_map<const RE::BGSLocation*, Position> AdventureTargets::GetWorldM
 	return markedPlaces;
 }
 
-// This can only be called from MCM so thread-safe. Build view containing the viable Worlds/Locations for this type.
+// This can only be called from MCM so thread-safe. Select view of the viable Worlds/Locations for this type.
 size_t AdventureTargets::ViableWorldCount(const size_t adventureType) const
 {
 	RecursiveLockGuard guard(m_adventureLock);
-	m_unvisitedLocationsByWorld.clear();
-	m_sortedWorlds.clear();
+	m_viewType = AdventureTargetType::MAX;
 	if (adventureType >= m_validAdventureTypes.size())
 		return 0;
 	// map from MCM index for list of adventure types with valid worlds back to enumeration
-	for (const RE::BGSLocation* location : m_locationsByType[size_t(m_validAdventureTypes[adventureType])])
-	{
-		if (VisitedPlaces::Instance().IsKnown(location))
-			continue;
-		const auto worldIter(m_worldByLocation.find(location));
-		if (worldIter == m_worldByLocation.cend())
-			continue;
-		const RE::TESWorldSpace* worldSpace(worldIter->second);
-		auto worldLocations(m_unvisitedLocationsByWorld.find(worldSpace));
-		if (worldLocations == m_unvisitedLocationsByWorld.cend())
-		{
-			worldLocations = m_unvisitedLocationsByWorld.insert({ worldSpace, {} }).first;
-			m_sortedWorlds.push_back(worldSpace);
-		}
-		DBG_MESSAGE("Viable Location {}/0x{:08x} in WorldSpace {}/0x{:08x}",
-			location->GetName(), location->GetFormID(), worldSpace->GetName(), worldSpace->GetFormID());
-		worldLocations->second.insert(location);
-	}
-	std::sort(m_sortedWorlds.begin(), m_sortedWorlds.end(), [=](const RE::TESWorldSpace* lhs, const RE::TESWorldSpace* rhs) -> bool {
-		std::string leftName(lhs->GetName());
-		std::string rightName(rhs->GetName());
-		return std::lexicographical_compare(leftName.cbegin(), leftName.cend(), rightName.cbegin(), rightName.cend());
-	});
-	return m_unvisitedLocationsByWorld.size();
+	m_viewType = m_validAdventureTypes[adventureType];
+	return m_sortedWorldsByType[size_t(m_viewType)].size();
 }
 
 std::string AdventureTargets::ViableWorldNameByIndexInView(const size_t worldIndex) const
 {
 	RecursiveLockGuard guard(m_adventureLock);
-	if (worldIndex >= m_sortedWorlds.size())
+	if (m_viewType == AdventureTargetType::MAX || worldIndex >= m_sortedWorldsByType[size_t(m_viewType)].size())
 	{
 		return "";
 	}
-	DBG_VMESSAGE("WorldSpace {} at index {}", m_sortedWorlds[worldIndex]->GetName(), worldIndex);
-	std::string name(m_sortedWorlds[worldIndex]->GetName());
-	if (m_sortedWorlds[worldIndex] == LocationTracker::Instance().CurrentPlayerWorld())
+	const RE::TESWorldSpace* world(m_sortedWorldsByType[size_t(m_viewType)][worldIndex]);
+	DBG_VMESSAGE("WorldSpace {} at index {}", world->GetName(), worldIndex);
+	std::string name(world->GetName());
+	if (world == LocationTracker::Instance().CurrentPlayerWorld())
 	{
 		// highlight player's current world for targeting
 		name.append("**");
@@ -694,12 +733,12 @@ std::string AdventureTargets::ViableWorldNameByIndexInView(const size_t worldInd
 void AdventureTargets::SelectCurrentDestination(const size_t worldIndex)
 {
 	RecursiveLockGuard guard(m_adventureLock);
-	if (worldIndex >= m_sortedWorlds.size())
+	if (m_viewType == AdventureTargetType::MAX || worldIndex >= m_sortedWorldsByType[size_t(m_viewType)].size())
 		return;
 
-	const RE::TESWorldSpace* world(m_sortedWorlds[worldIndex]);
-	const auto worldLocations(m_unvisitedLocationsByWorld.find(world));
-	if (worldLocations == m_unvisitedLocationsByWorld.cend())
+	const RE::TESWorldSpace* world(m_sortedWorldsByType[size_t(m_viewType)][worldIndex]);
+	const auto worldLocations(m_unvisitedByType[size_t(m_viewType)].find(world));
+	if (worldLocations == m_unvisitedByType[size_t(m_viewType)].cend())
 		return;
 	std::vector<const RE::BGSLocation*> candidates(worldLocations->second.cbegin(), worldLocations->second.cend());
 	if (candidates.empty())
@@ -780,6 +819,14 @@ bool AdventureTargets::HasActiveTarget(void) const
 	return m_targetLocation != nullptr;
 }
 
+bool AdventureTargets::IsTargetOfType(const RE::BGSLocation* location, const AdventureTargetType adventureType) const
+{
+	if (adventureType >= AdventureTargetType::MAX)
+		return false;
+	RecursiveLockGuard guard(m_adventureLock);
+	return m_locationsByType[size_t(adventureType)].contains(location);
+}
+
 void AdventureTargets::AsJSON(nlohmann::json& j) const
 {
 	RecursiveLockGuard guard(m_adventureLock);
@@ -798,6 +845,7 @@ void AdventureTargets::AsJSON(nlohmann::json& j) const
 void AdventureTargets::RecordEvent(const AdventureEvent& event)
 {
 	m_adventureEvents.push_back(event);
+	++m_generation;
 	Saga::Instance().AddEvent(event);
 }
 
@@ -818,6 +866,7 @@ void AdventureTargets::UpdateFrom(const nlohmann::json& j)
 		m_targetWorld = nullptr;
 		m_targetLocation = nullptr;
 	}
+	++m_generation;
 
 	m_adventureEvents.reserve(j["events"].size());
 	for (const nlohmann::json& adventureEvent : j["events"])
@@ -18,6 +18,8 @@ http://www.fsf.org/licensing/licenses
 >>> END OF LICENSE >>>
 *************************************************************************/
 #pragma once
+
+#include <atomic>
 #include "WorldState/PositionData.h"
 
 namespace shse
@@ -123,9 +125,14 @@ public:
 	const RE::BGSLocation* TargetLocation(void) const;
 	Position TargetPosition(void) const;
 	bool HasActiveTarget(void) const;
+	bool IsTargetOfType(const RE::BGSLocation* location, const AdventureTargetType adventureType) const;
 	std::unordered_map<const RE::BGSLocation*, Position> GetWorldMarkedPlaces(const RE::TESWorldSpace* world) const;
+	// called by VisitedPlaces when a Location first becomes known
+	void MarkVisited(const RE::BGSLocation* location);
 	void AsJSON(nlohmann::json& j) const;
 	void UpdateFrom(const nlohmann::json& j);
+	// advances whenever state saved to the cosave changes
+	inline uint64_t Generation() const { return m_generation; }
 
 private:
 	void LinkLocationToWorld(const RE::BGSLocation* location, const RE::TESWorldSpace* world) const;
@@ -135,6 +142,7 @@ private:
 	Position GetRefIDPosition(const RE::FormID refID, const RE::BGSLocation* location) const;
 	Position GetRefrPosition(const RE::TESObjectREFR* refr, const RE::BGSLocation* location) const;
 	void RecordEvent(const AdventureEvent& event);
+	void IndexUnvisited();
 
 	static std::unique_ptr<AdventureTargets> m_instance;
 	std::array<std::unordered_set<const RE::BGSLocation*>, int(AdventureTargetType::MAX)> m_locationsByType;
@@ -144,14 +152,23 @@ private:
 	std::unordered_map<const RE::BGSLocation*, Position> m_locationCoordinates;
 
 	std::unordered_map<const RE::TESWorldSpace*, std::unordered_set<const RE::BGSLocation*>> m_markedLocationsByWorld;
-	mutable std::unordered_map<const RE::TESWorldSpace*, std::unordered_set<const RE::BGSLocation*>> m_unvisitedLocationsByWorld;
-	mutable std::vector<const RE::TESWorldSpace*> m_sortedWorlds;
+
+	// Unvisited Locations by adventure type and world, with each type's worlds in name order. Built after Categorize
+	// and narrowed as Locations become known - VisitedPlaces never forgets a known Location, so entries only leave.
+	typedef std::unordered_map<const RE::TESWorldSpace*, std::unordered_set<const RE::BGSLocation*>> LocationsByWorld;
+	std::array<LocationsByWorld, int(AdventureTargetType::MAX)> m_unvisitedByType;
+	std::array<std::vector<const RE::TESWorldSpace*>, int(AdventureTargetType::MAX)> m_sortedWorldsByType;
+	// includes Locations with no known world, which are never viable targets
+	std::array<size_t, int(AdventureTargetType::MAX)> m_unvisitedCountByType;
+	// adventure type currently shown in MCM
+	mutable AdventureTargetType m_viewType;
 
 	std::vector<AdventureEvent> m_adventureEvents;
 
 	const RE::BGSLocation* m_targetLocation;
 	const RE::TESWorldSpace* m_targetWorld;
 	mutable RecursiveLock m_adventureLock;
+	std::atomic<uint64_t> m_generation = 0;
 };
 
 void to_json(nlohmann::json& j, const AdventureTargets& visitedPlaces);
@@ -0,0 +1,126 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#include "PrecompiledHeaders.h"
+
+#include "WorldState/AttachedCells.h"
+
+namespace shse
+{
+
+std::unique_ptr<AttachedCells> AttachedCells::m_instance;
+
+AttachedCells& AttachedCells::Instance()
+{
+	if (!m_instance)
+	{
+		m_instance = std::make_unique<AttachedCells>();
+	}
+	return *m_instance;
+}
+
+AttachedCells::AttachedCells() : m_registered(false)
+{
+}
+
+void AttachedCells::Register()
+{
+	RecursiveLockGuard guard(m_cellLock);
+	if (m_registered)
+		return;
+	RE::ScriptEventSourceHolder* eventSource(RE::ScriptEventSourceHolder::GetSingleton());
+	if (!eventSource)
+	{
+		REL_ERROR("Cannot register for cell loads, adjacent cells will be found by worldspace scan");
+		return;
+	}
+	eventSource->AddEventSink<RE::TESCellFullyLoadedEvent>(this);
+	m_registered = true;
+	REL_MESSAGE("Registered for cell loads");
+}
+
+RE::BSEventNotifyControl AttachedCells::ProcessEvent(const RE::TESCellFullyLoadedEvent* event,
+	RE::BSTEventSource<RE::TESCellFullyLoadedEvent>*)
+{
+	if (event && event->cell)
+	{
+		RecursiveLockGuard guard(m_cellLock);
+		Record(event->cell);
+	}
+	return RE::BSEventNotifyControl::kContinue;
+}
+
+void AttachedCells::Record(RE::TESObjectCELL* cell)
+{
+	if (cell->IsInteriorCell() || !cell->worldSpace)
+		return;
+	const auto coordinates(cell->GetCoordinates());
+	if (!coordinates)
+		return;
+	CellsByGrid& cells(m_cellsByWorld[cell->worldSpace]);
+	cells[GridKey(coordinates->cellX, coordinates->cellY)] = cell;
+	DBG_VMESSAGE("Attached cell 0x{:08x} at grid ({},{}) in WRLD 0x{:08x}", cell->GetFormID(),
+		coordinates->cellX, coordinates->cellY, cell->worldSpace->GetFormID());
+	if (cells.size() > PruneThreshold)
+	{
+		std::erase_if(cells, [](const auto& entry) -> bool { return !entry.second->IsAttached(); });
+		DBG_VMESSAGE("Pruned to {} attached cells in WRLD 0x{:08x}", cells.size(), cell->worldSpace->GetFormID());
+	}
+}
+
+RE::TESObjectCELL* AttachedCells::Find(const RE::TESWorldSpace* world, const int32_t gridX, const int32_t gridY)
+{
+	RecursiveLockGuard guard(m_cellLock);
+	const auto cells(m_cellsByWorld.find(world));
+	if (cells == m_cellsByWorld.end())
+		return nullptr;
+	const auto cell(cells->second.find(GridKey(gridX, gridY)));
+	if (cell == cells->second.end())
+		return nullptr;
+	if (!cell->second->IsAttached())
+	{
+		cells->second.erase(cell);
+		return nullptr;
+	}
+	return cell->second;
+}
+
+void AttachedCells::Seed(const RE::TESWorldSpace* world)
+{
+	RecursiveLockGuard guard(m_cellLock);
+	size_t seeded(0);
+	for (const auto& worldCell : world->cellMap)
+	{
+		RE::TESObjectCELL* cell(worldCell.second);
+		if (cell && cell->IsAttached())
+		{
+			Record(cell);
+			++seeded;
+		}
+	}
+	DBG_MESSAGE("Seeded {} attached cells from {} in WRLD 0x{:08x}", seeded, world->cellMap.size(), world->GetFormID());
+}
+
+void AttachedCells::Reset()
+{
+	RecursiveLockGuard guard(m_cellLock);
+	m_cellsByWorld.clear();
+}
+
+}
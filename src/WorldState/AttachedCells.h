@@ -0,0 +1,61 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#pragma once
+
+namespace shse
+{
+
+// Attached exterior CELLs per worldspace, keyed by grid coordinates and maintained from cell load events, so the
+// neighbours of the player's CELL are found by grid offset instead of walking the worldspace CELL map.
+class AttachedCells : public RE::BSTEventSink<RE::TESCellFullyLoadedEvent>
+{
+public:
+	static AttachedCells& Instance();
+	AttachedCells();
+
+	void Register();
+	virtual RE::BSEventNotifyControl ProcessEvent(const RE::TESCellFullyLoadedEvent* event,
+		RE::BSTEventSource<RE::TESCellFullyLoadedEvent>* eventSource) override;
+	// attached exterior CELL at the grid coordinates, or nullptr - CELLs detached since load are dropped here
+	RE::TESObjectCELL* Find(const RE::TESWorldSpace* world, const int32_t gridX, const int32_t gridY);
+	// index attached exterior CELLs by walking the worldspace, for CELLs loaded before we were listening
+	void Seed(const RE::TESWorldSpace* world);
+	void Reset();
+
+private:
+	typedef std::unordered_map<uint64_t, RE::TESObjectCELL*> CellsByGrid;
+
+	static inline uint64_t GridKey(const int32_t gridX, const int32_t gridY)
+	{
+		return (static_cast<uint64_t>(static_cast<uint32_t>(gridX)) << 32) | static_cast<uint32_t>(gridY);
+	}
+	void Record(RE::TESObjectCELL* cell);
+
+	static std::unique_ptr<AttachedCells> m_instance;
+	// loaded area is 5x5 CELLs by default, prune detached CELLs if a worldspace's entries grow well beyond that
+	static constexpr size_t PruneThreshold = 64;
+
+	// events arrive on the game thread, lookups from the plugin thread
+	mutable RecursiveLock m_cellLock;
+	bool m_registered;
+	std::unordered_map<const RE::TESWorldSpace*, CellsByGrid> m_cellsByWorld;
+};
+
+}
@@ -0,0 +1,98 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#include "PrecompiledHeaders.h"
+
+#include "WorldState/InventoryTracker.h"
+#include "Data/LoadOrder.h"
+
+namespace shse
+{
+
+std::unique_ptr<InventoryTracker> InventoryTracker::m_instance;
+
+InventoryTracker& InventoryTracker::Instance()
+{
+	if (!m_instance)
+	{
+		m_instance = std::make_unique<InventoryTracker>();
+	}
+	return *m_instance;
+}
+
+InventoryTracker::InventoryTracker() : m_registered(false), m_playerID(InvalidForm)
+{
+}
+
+void InventoryTracker::Register()
+{
+	RecursiveLockGuard guard(m_inventoryLock);
+	if (m_registered)
+		return;
+	RE::ScriptEventSourceHolder* eventSource(RE::ScriptEventSourceHolder::GetSingleton());
+	RE::PlayerCharacter* player(RE::PlayerCharacter::GetSingleton());
+	if (!eventSource || !player)
+	{
+		REL_ERROR("Cannot register for container changes, player inventory will be rescanned in full");
+		return;
+	}
+	m_playerID = player->GetFormID();
+	eventSource->AddEventSink<RE::TESContainerChangedEvent>(this);
+	m_registered = true;
+	REL_MESSAGE("Registered for container changes to Player 0x{:08x}", m_playerID);
+}
+
+RE::BSEventNotifyControl InventoryTracker::ProcessEvent(const RE::TESContainerChangedEvent* event,
+	RE::BSTEventSource<RE::TESContainerChangedEvent>*)
+{
+	if (!event || event->baseObj == InvalidForm || event->itemCount == 0)
+		return RE::BSEventNotifyControl::kContinue;
+	int32_t delta(0);
+	if (event->newContainer == m_playerID)
+	{
+		delta = event->itemCount;
+	}
+	else if (event->oldContainer == m_playerID)
+	{
+		delta = -event->itemCount;
+	}
+	else
+	{
+		return RE::BSEventNotifyControl::kContinue;
+	}
+	RecursiveLockGuard guard(m_inventoryLock);
+	m_deltas[event->baseObj] += delta;
+	return RE::BSEventNotifyControl::kContinue;
+}
+
+InventoryTracker::CountDeltas InventoryTracker::TakeDeltas()
+{
+	RecursiveLockGuard guard(m_inventoryLock);
+	CountDeltas deltas;
+	deltas.swap(m_deltas);
+	return deltas;
+}
+
+void InventoryTracker::Reset()
+{
+	RecursiveLockGuard guard(m_inventoryLock);
+	m_deltas.clear();
+}
+
+}
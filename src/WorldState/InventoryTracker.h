@@ -0,0 +1,51 @@
+/*************************************************************************
+SmartHarvest SE
+Copyright (c) Steve Townsend 2021
+
+>>> SOURCE LICENSE >>>
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation (www.fsf.org); either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+A copy of the GNU General Public License is available at
+http://www.fsf.org/licensing/licenses
+>>> END OF LICENSE >>>
+*************************************************************************/
+#pragma once
+
+namespace shse
+{
+
+// Net change in player inventory count per base object, accumulated from container-changed events between
+// consumer passes. Consumers diff only the items whose counts moved instead of rescanning the full inventory.
+class InventoryTracker : public RE::BSTEventSink<RE::TESContainerChangedEvent>
+{
+public:
+	typedef std::unordered_map<RE::FormID, int32_t> CountDeltas;
+
+	static InventoryTracker& Instance();
+	InventoryTracker();
+
+	void Register();
+	virtual RE::BSEventNotifyControl ProcessEvent(const RE::TESContainerChangedEvent* event,
+		RE::BSTEventSource<RE::TESContainerChangedEvent>* eventSource) override;
+	CountDeltas TakeDeltas();
+	void Reset();
+
+private:
+	static std::unique_ptr<InventoryTracker> m_instance;
+
+	// events arrive on the game thread, consumed by the plugin thread
+	mutable RecursiveLock m_inventoryLock;
+	bool m_registered;
+	RE::FormID m_playerID;
+	CountDeltas m_deltas;
+};
+
+}
@@ -27,6 +27,7 @@ http://www.fsf.org/licensing/licenses
 #include "Data/SettingsCache.h"
 #include "Looting/ManagedLists.h"
 #include "WorldState/AdventureTargets.h"
+#include "WorldState/AttachedCells.h"
 #include "WorldState/PartyMembers.h"
 #include "WorldState/PlayerHouses.h"
 #include "WorldState/PlayerState.h"
@@ -53,46 +54,44 @@ LocationTracker& LocationTracker::Instance()
 LocationTracker::LocationTracker() : 
 	m_playerCellID(InvalidForm), m_playerCellX(0.), m_playerCellY(0.), m_playerIndoors(false),
 	m_tellPlayerIfCanLootAfterLoad(false), m_playerLocation(nullptr), m_playerParentWorld(nullptr),
-	m_aiRunning(false)
+	m_markers(nullptr), m_aiRunning(false)
 {
 }
 
 // called when Player moves to a new WorldSpace, including on game load/reload
 void LocationTracker::RecordMarkedPlaces()
 {
-	// replace existing entries with new
-	m_markedPlaces = AdventureTargets::Instance().GetWorldMarkedPlaces(m_playerParentWorld);
-	if (m_markedPlaces.empty())
+	// map markers are fixed after data load, so each worldspace's tree is built on first entry and reused thereafter
+	const auto cached(m_markersByWorld.find(m_playerParentWorld));
+	if (cached != m_markersByWorld.cend())
+	{
+		m_markers = &cached->second;
+		DBG_MESSAGE("Reuse tree of {} LCTNs for WRLD 0x{:08x}", m_markers->Size(), m_playerParentWorld->GetFormID());
+		return;
+	}
+	// worldspace with no map markers gets an empty tree, so the lookup is not repeated
+	KDTree& markers(m_markersByWorld[m_playerParentWorld]);
+	m_markers = &markers;
+	const auto markedPlaces(AdventureTargets::Instance().GetWorldMarkedPlaces(m_playerParentWorld));
+	if (markedPlaces.empty())
 	{
 		DBG_VMESSAGE("No map markers within this worldspace");
 		return;
 	}
-	size_t numPlaces(m_markedPlaces.size());
-	DBG_MESSAGE("Build tree from {} LCTNs", numPlaces);
+	DBG_MESSAGE("Build tree from {} LCTNs for WRLD 0x{:08x}, {} worldspaces indexed", markedPlaces.size(),
+		m_playerParentWorld->GetFormID(), m_markersByWorld.size());
 
-	// Build KD-tree for the location markers
-	std::vector<double> pointData;
-	pointData.reserve(3 * numPlaces);
-	std::vector<alglib::ae_int_t> tagList;
-	tagList.reserve(numPlaces);
-	std::for_each(m_markedPlaces.cbegin(), m_markedPlaces.cend(), [&](const auto& posForm)
+	// Build KD-tree for the location markers, tagged with LCTN FormID
+	std::vector<std::pair<KDTree::Point, KDTree::Tag>> points;
+	points.reserve(markedPlaces.size());
+	for (const auto& posForm : markedPlaces)
 	{
-		tagList.push_back(posForm.first->GetFormID());
-		pointData.push_back(std::get<0>(posForm.second));
-		pointData.push_back(std::get<1>(posForm.second));
-		pointData.push_back(std::get<2>(posForm.second));
-	});
-
-	alglib::real_2d_array coordinates;
-	coordinates.setcontent(static_cast<alglib::ae_int_t>(numPlaces), 3, &pointData[0]);
-	alglib::integer_1d_array tags;
-	tags.setcontent(static_cast<alglib::ae_int_t>(numPlaces), &tagList[0]);
-
-	// use Euclidean norm 2 for 3D space
-	alglib::kdtreebuildtagged(coordinates, tags, static_cast<alglib::ae_int_t>(numPlaces), 3, 0, 2, m_markers);
+		points.emplace_back(posForm.second, posForm.first->GetFormID());
+	}
+	markers.Build(points);
 }
 
-CompassDirection LocationTracker::DirectionToDestinationFromStart(const AlglibPosition& start, const AlglibPosition& destination) const
+CompassDirection LocationTracker::DirectionToDestinationFromStart(const DoublePosition& start, const DoublePosition& destination) const
 {
 	// only uses (x, y) parts of the endpoints
 	double deltaX(destination[0] - start[0]);
@@ -270,29 +269,20 @@ void LocationTracker::DisplayPlayerLocation() const
 	}
 }
 
-std::string LocationTracker::LocationRelativeToNearestMapMarker(const AlglibPosition& position, const bool historic) const
+std::string LocationTracker::LocationRelativeToNearestMapMarker(const DoublePosition& position, const bool historic) const
 {
 	std::string locationStr;
-	RelativeLocationDescriptor nearestMarker(NearestMapMarker(position));
-	if (nearestMarker == RelativeLocationDescriptor::Invalid())
+	const std::vector<NearbyPlace> nearest(NearbyMarkedPlaces(position, 1));
+	if (nearest.empty())
 	{
 		REL_WARNING("Could not determine nearest map marker to position ({:0.2f}, {:0.2f})", position[0], position[1]);
 		return locationStr;
 	}
-	CompassDirection heading(DirectionToDestinationFromStart(nearestMarker.EndPoint(), nearestMarker.StartPoint()));
-
-	double milesAway(UnitsToMiles(nearestMarker.UnitsAway()));
-	RE::BGSLocation* location(RE::TESForm::LookupByID<RE::BGSLocation>(nearestMarker.LocationID()));
-	if (location)
-	{
-		DBG_MESSAGE("Position is {} of nearest Location map marker {}/0x{:08x} at distance {:0.2f} miles",
-			CompassDirectionName(heading).c_str(), location->GetName(), nearestMarker.LocationID(), milesAway);
-		locationStr = NearbyLocationAsString(location, milesAway, heading, historic);
-	}
-	else
-	{
-		REL_WARNING("Could not determine Location for 0x{:08x}", nearestMarker.LocationID());
-	}
+	const NearbyPlace& place(nearest.front());
+	double milesAway(UnitsToMiles(place.m_unitsAway));
+	DBG_MESSAGE("Position is {} of nearest Location map marker {}/0x{:08x} at distance {:0.2f} miles",
+		CompassDirectionName(place.m_heading).c_str(), place.m_location->GetName(), place.m_location->GetFormID(), milesAway);
+	locationStr = NearbyLocationAsString(place.m_location, milesAway, place.m_heading, historic);
 	return locationStr;
 }
 
@@ -301,7 +291,7 @@ void LocationTracker::PlayerLocationRelativeToNearestMapMarker(const RE::BGSLoca
 #ifdef _PROFILING
 	WindowsUtils::ScopedTimer elapsed("Locate relative to map marker");
 #endif
-	AlglibPosition playerPos(PlayerState::Instance().GetAlglibPosition());
+	DoublePosition playerPos(PlayerState::Instance().GetDoublePosition());
 	RecursiveLockGuard guard(m_locationLock);
 	if (m_playerLocation)
 	{
@@ -324,39 +314,52 @@ void LocationTracker::PlayerLocationRelativeToNearestMapMarker(const RE::BGSLoca
 	}
 }
 
-// scan the KD-tree for nearest map marker to a reference position
-RelativeLocationDescriptor LocationTracker::NearestMapMarker(const AlglibPosition& refPos) const
+// Scan the KD-tree once for the map markers nearest a reference position, filtered during the traversal. Filters call
+// into AdventureTargets and VisitedPlaces, so the scan runs outside our lock - a worldspace's tree is immutable once built.
+std::vector<NearbyPlace> LocationTracker::NearbyMarkedPlaces(const DoublePosition& refPos, const size_t count,
+	const AdventureTargetType adventureType, const VisitedFilter visited) const
 {
-	alglib::real_1d_array coordinates;
-	coordinates.setcontent(3, refPos.data());
-	alglib::ae_int_t result(alglib::kdtreequeryknn(m_markers, coordinates, 1));
-	if (result != 1)
+	const KDTree* markers(nullptr);
 	{
-		REL_WARNING("Expected 1 match for nearest map marker, got {}", result);
-		return RelativeLocationDescriptor::Invalid();
+		RecursiveLockGuard guard(m_locationLock);
+		markers = m_markers;
 	}
-	// get distance - overwrite the input to avoid another allocation
-	kdtreequeryresultsdistances(m_markers, coordinates);
-	double unitsAway(coordinates[0]);
-
-	// get tag, into preallocated buffer
-	alglib::integer_1d_array tags;
-	alglib::ae_int_t dummy(0);
-	tags.setcontent(1, &dummy);
-	kdtreequeryresultstags(m_markers, tags);
-	RE::FormID location(static_cast<RE::FormID>(tags[0]));
-	DBG_MESSAGE("Nearest Map Marker to ({:0.2f},{:0.2f},{:0.2f}) has formID 0x{:08x}", refPos[0], refPos[1], refPos[2], location);
+	if (!markers || count == 0)
+		return {};
 
-	// get coordinates for the nearest marker
-	alglib::real_2d_array marker;
-	marker.setlength(1, 3);
-	kdtreequeryresultsx(m_markers, marker);
-
-	AlglibPosition markerPos = { marker(0, 0), marker(0, 1), marker(0, 2) };
-	return RelativeLocationDescriptor(refPos, markerPos, location, unitsAway);
+	KDTree::Filter accept;
+	if (adventureType != AdventureTargetType::MAX || visited != VisitedFilter::Any)
+	{
+		accept = [=](const KDTree::Tag tag) -> bool {
+			const RE::BGSLocation* location(RE::TESForm::LookupByID<RE::BGSLocation>(tag));
+			if (!location)
+				return false;
+			if (adventureType != AdventureTargetType::MAX && !AdventureTargets::Instance().IsTargetOfType(location, adventureType))
+				return false;
+			return visited == VisitedFilter::Any || VisitedPlaces::Instance().IsKnown(location) == (visited == VisitedFilter::Visited);
+		};
+	}
+	const KDTree::Point query({ static_cast<float>(refPos[0]), static_cast<float>(refPos[1]), static_cast<float>(refPos[2]) });
+	const std::vector<KDTree::Neighbour> nearest(markers->KNearest(query, count, accept));
+	std::vector<NearbyPlace> places;
+	places.reserve(nearest.size());
+	for (const KDTree::Neighbour& neighbour : nearest)
+	{
+		const RE::BGSLocation* location(RE::TESForm::LookupByID<RE::BGSLocation>(neighbour.m_tag));
+		if (!location)
+		{
+			REL_WARNING("Could not determine Location for 0x{:08x}", neighbour.m_tag);
+			continue;
+		}
+		const DoublePosition markerPos = { neighbour.m_point[0], neighbour.m_point[1], neighbour.m_point[2] };
+		places.push_back({ location, markerPos, neighbour.m_distance, DirectionToDestinationFromStart(markerPos, refPos) });
+	}
+	DBG_MESSAGE("{} of {} Map Markers found near ({:0.2f},{:0.2f},{:0.2f}), type {}, visited filter {}", places.size(), count,
+		refPos[0], refPos[1], refPos[2], AdventureTargetNameByIndex(size_t(adventureType)), int(visited));
+	return places;
 }
 
-double DistanceBetween(const AlglibPosition& pos1, const AlglibPosition& pos2)
+double DistanceBetween(const DoublePosition& pos1, const DoublePosition& pos2)
 {
 	double dx(pos1[0] - pos2[0]);
 	double dy(pos1[1] - pos2[1]);
@@ -368,9 +371,9 @@ double DistanceBetween(const AlglibPosition& pos1, const AlglibPosition& pos2)
 }
 
 RelativeLocationDescriptor LocationTracker::MarkedLocationPosition(
-	const Position targetPosition, const RE::BGSLocation* location, const AlglibPosition& refPos) const
+	const Position targetPosition, const RE::BGSLocation* location, const DoublePosition& refPos) const
 {
-	AlglibPosition markerPos({ targetPosition[0], targetPosition[1], targetPosition[2] });
+	DoublePosition markerPos({ targetPosition[0], targetPosition[1], targetPosition[2] });
 	double unitsAway(DistanceBetween(markerPos, refPos));
 	return RelativeLocationDescriptor(refPos, markerPos, location->GetFormID(), unitsAway);
 }
@@ -415,7 +418,7 @@ const RE::BGSLocation* LocationTracker::PlayerLocationRelativeToAdventureTarget(
 		PrintDifferentWorld(world);
 		return nullptr;
 	}
-	AlglibPosition playerPos(PlayerState::Instance().GetAlglibPosition());
+	DoublePosition playerPos(PlayerState::Instance().GetDoublePosition());
 	RelativeLocationDescriptor targetLocation(MarkedLocationPosition(targetPosition, location, playerPos));
 	if (targetLocation == RelativeLocationDescriptor::Invalid())
 	{
@@ -431,11 +434,8 @@ const RE::BGSLocation* LocationTracker::PlayerLocationRelativeToAdventureTarget(
 	return location;
 }
 
-CellOwnership LocationTracker::GetCellOwnership(const RE::TESObjectCELL* cell) const
+CellOwnership LocationTracker::GetCellOwnership(const RE::TESForm* owner, const RE::FormID cellID) const
 {
-	if (!cell)
-		return CellOwnership::NoOwner;
-	RE::TESForm* owner = GetCellOwner(cell);
 	if (!owner)
 		return CellOwnership::NoOwner;
 	if (owner->formType == RE::FormType::NPC)
@@ -457,7 +457,7 @@ CellOwnership LocationTracker::GetCellOwnership(const RE::TESObjectCELL* cell) c
 		}
 		return CellOwnership::OtherFaction;
 	}
-	REL_WARNING("Owner 0x{:08x} exists but uncategorized in cell 0x{:08x}", owner->GetFormID(), cell->GetFormID());
+	REL_WARNING("Owner 0x{:08x} exists but uncategorized in cell 0x{:08x}", owner->GetFormID(), cellID);
 	return CellOwnership::NoOwner;
 }
 
@@ -487,7 +487,10 @@ void LocationTracker::Reset()
 	m_adjacentCells.fill({ std::numeric_limits<float>::max(), nullptr });
 	m_playerLocation = nullptr;
 	m_playerParentWorld = nullptr;
-	m_markedPlaces.clear();
+	m_verdictsByCell.clear();
+	AttachedCells::Instance().Reset();
+	// per-worldspace trees are game data and survive reload, only the current world is reset
+	m_markers = nullptr;
 }
 
 const RE::TESWorldSpace* LocationTracker::ParentWorld(const RE::TESObjectCELL* cell)
@@ -697,7 +700,7 @@ bool LocationTracker::Refresh()
 bool LocationTracker::IsPlayerAtHome() const
 {
 	RecursiveLockGuard guard(m_locationLock);
-	return IsPlacePlayerHome(m_playerCellID, m_playerLocation);
+	return Verdicts(m_playerCellID, m_playerLocation).m_playerHome;
 }
 
 bool LocationTracker::IsPlacePlayerHome(const RE::FormID cellID, const RE::BGSLocation* location) const
@@ -724,22 +727,23 @@ bool LocationTracker::IsPlaceLootable(
 	// whitelist overrides all other considerations
 	DBG_DMESSAGE("Check autoloot for cell 0x{:08x}, location {}/0x{:08x}", cellID,
 		location ? location->GetName() : "", location ? location->GetFormID() : InvalidForm);
-	if (IsPlaceWhitelisted(cellID, location))
+	const PlaceVerdicts verdicts(Verdicts(cellID, location));
+	if (verdicts.m_whitelisted)
 	{
 		DBG_DMESSAGE("Player location is on WhiteList");
 		return true;
 	}
-	if (IsPlacePlayerHome(cellID, location))
+	if (verdicts.m_playerHome)
 	{
 		DBG_DMESSAGE("Player House: no looting");
 		return false;
 	}
-	if (IsPlaceBlacklisted(cellID, location))
+	if (verdicts.m_blacklisted)
 	{
 		DBG_DMESSAGE("Player location is on BlackList");
 		return false;
 	}
-	if (!lootableIfRestricted && IsPlaceRestrictedLootSettlement(cellID, location))
+	if (!lootableIfRestricted && verdicts.m_restrictedSettlement)
 	{
 		DBG_DMESSAGE("Player location is restricted as population center");
 		return false;
@@ -747,6 +751,40 @@ bool LocationTracker::IsPlaceLootable(
 	return true;
 }
 
+// each source only ever advances, so the sum changes whenever any of them does
+uint64_t LocationTracker::PlaceGeneration()
+{
+	return SettingsCache::Instance().Generation() + ManagedList::WhiteList().Generation() +
+		ManagedList::BlackList().Generation() + PlayerHouses::Instance().Generation();
+}
+
+// Evaluate the place once per cell, location and generation. Scan and loot checks ask the same questions about the
+// player's place on every pass, and the whitelist and blacklist checks can fall back to a name search of the list.
+LocationTracker::PlaceVerdicts LocationTracker::Verdicts(const RE::FormID cellID, const RE::BGSLocation* location) const
+{
+	RecursiveLockGuard guard(m_locationLock);
+	const uint64_t generation(PlaceGeneration());
+	if (m_verdictsByCell.size() >= MaxCachedVerdicts && !m_verdictsByCell.contains(cellID))
+	{
+		m_verdictsByCell.clear();
+	}
+	const auto cached(m_verdictsByCell.try_emplace(cellID));
+	PlaceVerdicts& verdicts(cached.first->second);
+	if (!cached.second && verdicts.m_location == location && verdicts.m_generation == generation)
+		return verdicts;
+
+	verdicts.m_location = location;
+	verdicts.m_generation = generation;
+	verdicts.m_whitelisted = IsPlaceWhitelisted(cellID, location);
+	verdicts.m_playerHome = IsPlacePlayerHome(cellID, location);
+	verdicts.m_blacklisted = IsPlaceBlacklisted(cellID, location);
+	verdicts.m_restrictedSettlement = IsPlaceRestrictedLootSettlement(cellID, location);
+	DBG_VMESSAGE("Place verdicts for cell 0x{:08x}, location 0x{:08x} at generation {}: whitelist {}, home {}, blacklist {}, restricted {}",
+		cellID, location ? location->GetFormID() : InvalidForm, generation, verdicts.m_whitelisted, verdicts.m_playerHome,
+		verdicts.m_blacklisted, verdicts.m_restrictedSettlement);
+	return verdicts;
+}
+
 // take a copy for thread safety
 decltype(LocationTracker::m_adjacentCells) LocationTracker::AdjacentCells() const {
 	RecursiveLockGuard guard(m_locationLock);
@@ -769,39 +807,35 @@ void LocationTracker::RecordAdjacentCells(const RE::TESObjectCELL* current)
 
 	// For exterior cells, also check directly adjacent cells for lootable goodies.
 	// Restrict to cells in the same worldspace, without walking parents.
-	if (!m_playerIndoors)
-	{
-		DBG_VMESSAGE("Check for adjacent cells to 0x{:08x}", m_playerCellID);
-		if (current->worldSpace)
+	if (!m_playerIndoors && current->worldSpace)
+	{
+		DBG_VMESSAGE("Check for adjacent cells to 0x{:08x} in Worldspace {}/0x{:08x}", m_playerCellID,
+			current->worldSpace->GetName(), current->worldSpace->GetFormID());
+		const auto coordinates(const_cast<RE::TESObjectCELL*>(current)->GetCoordinates());
+		if (!coordinates)
+			return;
+		// player CELL missing from the index means its load was not seen, pick up what is attached now
+		AttachedCells& attachedCells(AttachedCells::Instance());
+		if (attachedCells.Find(current->worldSpace, coordinates->cellX, coordinates->cellY) != current)
 		{
-			DBG_VMESSAGE("Worldspace is {}/0x{:08x}", current->worldSpace->GetName(), current->worldSpace->GetFormID());
-			for (const auto& worldCell : current->worldSpace->cellMap)
+			attachedCells.Seed(current->worldSpace);
+		}
+		// interior CELLs are not indexed, so we never loot across the interior/exterior boundary
+		size_t adjacent(0);
+		for (int32_t offsetX = -1; offsetX <= 1; ++offsetX)
+		{
+			for (int32_t offsetY = -1; offsetY <= 1; ++offsetY)
 			{
-				RE::TESObjectCELL* candidateCell(worldCell.second);
-				// skip player cell, handled above
-				if (candidateCell->GetFormID() == m_playerCellID)
-				{
-					DBG_VMESSAGE("Player cell, already handled");
+				// skip player cell, handled by the caller
+				if (offsetX == 0 && offsetY == 0)
 					continue;
-				}
-				// do not loot across interior/exterior boundary
-				if (candidateCell->IsInteriorCell())
-				{
-					DBG_VMESSAGE("Candidate cell 0x{:08x} flagged as interior", candidateCell->GetFormID());
+				RE::TESObjectCELL* candidateCell(
+					attachedCells.Find(current->worldSpace, coordinates->cellX + offsetX, coordinates->cellY + offsetY));
+				if (!candidateCell)
 					continue;
-				}
-				// check for proximity to player CELL - do not record if more distant than all current possibles
 				const float distance(DistanceTo(candidateCell));
-				for (auto& comparand : m_adjacentCells)
-				{
-					if (comparand.first > distance)
-					{
-						DBG_VMESSAGE("Record adjacent cell 0x{:08x} at distance {:0.3f}", candidateCell->GetFormID(), distance);
-						comparand.first = distance;
-						comparand.second = candidateCell;
-						break;
-					}
-				}
+				DBG_VMESSAGE("Record adjacent cell 0x{:08x} at distance {:0.3f}", candidateCell->GetFormID(), distance);
+				m_adjacentCells[adjacent++] = { distance, candidateCell };
 			}
 		}
 	}
@@ -825,7 +859,7 @@ const RE::TESObjectCELL* LocationTracker::PlayerCell() const
 bool LocationTracker::IsPlayerInWhitelistedPlace() const
 {
 	RecursiveLockGuard guard(m_locationLock);
-	return IsPlaceWhitelisted(m_playerCellID, m_playerLocation);
+	return Verdicts(m_playerCellID, m_playerLocation).m_whitelisted;
 }
 
 bool LocationTracker::IsPlaceWhitelisted(const RE::FormID cellID, const RE::BGSLocation* location) const
@@ -848,7 +882,7 @@ bool LocationTracker::IsPlayerInRestrictedLootSettlement() const
 {
 	RecursiveLockGuard guard(m_locationLock);
 	// whitelist check done before we get called
-	return IsPlaceRestrictedLootSettlement(m_playerCellID, m_playerLocation);
+	return Verdicts(m_playerCellID, m_playerLocation).m_restrictedSettlement;
 }
 
 bool LocationTracker::IsPlaceRestrictedLootSettlement(const RE::FormID cellID, const RE::BGSLocation* location) const
@@ -865,7 +899,8 @@ bool LocationTracker::IsPlayerInFriendlyCell() const
 	RecursiveLockGuard guard(m_locationLock);
 	// Player Location may be empty e.g. if we are in the wilderness
 	// Player Cell should never be empty
-	CellOwnership ownership(GetCellOwnership(PlayerCell()));
+	const RE::TESObjectCELL* cell(PlayerCell());
+	CellOwnership ownership(cell ? GetCellOwnership(GetCellOwner(cell), m_playerCellID) : CellOwnership::NoOwner);
 	bool isFriendly(IsPlayerFriendly(ownership));
 	DBG_DMESSAGE("Cell ownership {}, allow Ownerless looting = {}", CellOwnershipName(ownership).c_str(), isFriendly ? "true" : "false");
 	return isFriendly;
@@ -19,13 +19,23 @@ http://www.fsf.org/licensing/licenses
 *************************************************************************/
 #pragma once
 
-#include "alglib/alglibmisc.h"
+#include "Utilities/KDTree.h"
 #include "Utilities/utils.h"
+#include "WorldState/AdventureTargets.h"
 #include "WorldState/PositionData.h"
 
 namespace shse
 {
 
+// map-marked place near a reference position, heading is that of the reference position as seen from the place
+struct NearbyPlace
+{
+	const RE::BGSLocation* m_location;
+	DoublePosition m_position;
+	double m_unitsAway;
+	CompassDirection m_heading;
+};
+
 class LocationTracker
 {
 private:
@@ -36,16 +46,15 @@ private:
 	bool IsPlaceBlacklisted(const RE::FormID cellID, const RE::BGSLocation* location) const;
 	void PlayerLocationRelativeToNearestMapMarker(const RE::BGSLocation* locationDone) const;
 	const RE::BGSLocation* PlayerLocationRelativeToAdventureTarget(void) const;
-	CompassDirection DirectionToDestinationFromStart(const AlglibPosition& start, const AlglibPosition& destination) const;
+	CompassDirection DirectionToDestinationFromStart(const DoublePosition& start, const DoublePosition& destination) const;
 	const RE::TESWorldSpace* ParentWorld(const RE::TESObjectCELL* cell);
-	RelativeLocationDescriptor NearestMapMarker(const AlglibPosition& refPos) const;
 	RelativeLocationDescriptor MarkedLocationPosition(
-		const Position targetPosition, const RE::BGSLocation* location, const AlglibPosition& refPos) const;
+		const Position targetPosition, const RE::BGSLocation* location, const DoublePosition& refPos) const;
 	inline double UnitsToMiles(const double units) const
 	{
 		return units * DistanceUnitInMiles;
 	}
-	CellOwnership GetCellOwnership(const RE::TESObjectCELL* cell) const;
+	CellOwnership GetCellOwnership(const RE::TESForm* owner, const RE::FormID cellID) const;
 	RE::TESForm* GetCellOwner(const RE::TESObjectCELL* cell) const;
 	std::string PlaceName(const RE::TESForm*) const;
 	bool IsPlacePlayerHome(const RE::FormID cellID, const RE::BGSLocation* location) const;
@@ -53,8 +62,22 @@ private:
 	bool IsPlaceWhitelisted(const RE::FormID cellID, const RE::BGSLocation* location) const;
 	bool IsPlaceRestrictedLootSettlement(const RE::FormID cellID, const RE::BGSLocation* location) const;
 
+	// Verdicts on a place, valid until settings, WhiteList, BlackList or player houses change. Cell ownership is not
+	// cached, scripts can change it while the player stays in the cell.
+	struct PlaceVerdicts
+	{
+		const RE::BGSLocation* m_location = nullptr;
+		uint64_t m_generation = 0;
+		bool m_whitelisted = false;
+		bool m_playerHome = false;
+		bool m_blacklisted = false;
+		bool m_restrictedSettlement = false;
+	};
+	PlaceVerdicts Verdicts(const RE::FormID cellID, const RE::BGSLocation* location) const;
+	static uint64_t PlaceGeneration();
+
 	static std::unique_ptr<LocationTracker> m_instance;
-	// 3x3 CELL adjacency check - 8 nearest CELLs are treated as adjacent to player's CELL, if exterior
+	// 3x3 CELL adjacency check - attached CELLs at the 8 neighbouring grid positions of player's CELL, if exterior
 	std::array<std::pair<float,RE::TESObjectCELL*>, 8> m_adjacentCells;
 	RE::FormID m_playerCellID;
 	float m_playerCellX;
@@ -65,8 +88,12 @@ private:
 	const RE::BGSLocation* m_playerLocation;
 	const RE::TESWorldSpace* m_playerParentWorld;
 
-	std::unordered_map<const RE::BGSLocation*, Position> m_markedPlaces;
-	alglib::kdtree m_markers;
+	// map marker KD-tree per worldspace, built lazily - current worldspace's tree is selected on entry
+	std::unordered_map<const RE::TESWorldSpace*, KDTree> m_markersByWorld;
+	const KDTree* m_markers;
+	// recently visited cells only - the player's current and prior cells are the ones asked about
+	static constexpr size_t MaxCachedVerdicts = 16;
+	mutable std::unordered_map<RE::FormID, PlaceVerdicts> m_verdictsByCell;
 	mutable RecursiveLock m_locationLock;
 	mutable std::atomic<bool> m_aiRunning;
 
@@ -98,7 +125,10 @@ public:
 	void PrintPlayerLocation(const RE::BGSLocation* location) const;
 	std::string NearbyLocationAsString(
 		const RE::BGSLocation* location, const double milesAway, const CompassDirection heading, const bool historic) const;
-	std::string LocationRelativeToNearestMapMarker(const AlglibPosition& position, const bool historic) const;
+	std::string LocationRelativeToNearestMapMarker(const DoublePosition& position, const bool historic) const;
+	// up to count map-marked places in the player's worldspace nearest the reference position, nearest first
+	std::vector<NearbyPlace> NearbyMarkedPlaces(const DoublePosition& refPos, const size_t count,
+		const AdventureTargetType adventureType = AdventureTargetType::MAX, const VisitedFilter visited = VisitedFilter::Any) const;
 	void PrintAdventureTargetInfo(const RE::BGSLocation* location, const double milesAway, CompassDirection heading) const;
 	void PrintDifferentWorld(const RE::TESWorldSpace* world) const;
 
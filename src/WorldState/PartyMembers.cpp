@@ -77,11 +77,13 @@ void PartyMembers::Reset()
 {
 	RecursiveLockGuard guard(m_partyLock);
 	m_followers.clear();
+	++m_generation;
 }
 
 void PartyMembers::RecordUpdate(const PartyUpdate& partyUpdate)
 {
 	m_partyUpdates.push_back(partyUpdate);
+	++m_generation;
 	Saga::Instance().AddEvent(partyUpdate);
 }
 
@@ -119,6 +121,7 @@ void PartyMembers::AdjustParty(const Followers& followers, const float gameTime)
 
 void PartyMembers::AsJSON(nlohmann::json& j) const
 {
+	RecursiveLockGuard guard(m_partyLock);
 	nlohmann::json updates(nlohmann::json::array());
 	for (const auto& update : m_partyUpdates)
 	{
@@ -164,6 +167,7 @@ void PartyMembers::UpdateFrom(const nlohmann::json& j)
 		}
 		m_followers.insert(actor);
 	}
+	++m_generation;
 }
 
 void to_json(nlohmann::json& j, const PartyMembers& partyMembers)
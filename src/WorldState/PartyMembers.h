@@ -19,6 +19,8 @@ http://www.fsf.org/licensing/licenses
 *************************************************************************/
 #pragma once
 
+#include <atomic>
+
 namespace shse
 {
 
@@ -51,12 +53,15 @@ public:
 
 	void AsJSON(nlohmann::json& j) const;
 	void UpdateFrom(const nlohmann::json& j);
+	// advances whenever state saved to the cosave changes
+	inline uint64_t Generation() const { return m_generation; }
 
 private:
 	static std::unique_ptr<PartyMembers> m_instance;
 	std::vector<PartyUpdate> m_partyUpdates;
 	Followers m_followers;
 	mutable RecursiveLock m_partyLock;
+	std::atomic<uint64_t> m_generation = 0;
 };
 
 void to_json(nlohmann::json& j, const PartyMembers& partyMembers);
@@ -25,6 +25,9 @@ http://www.fsf.org/licensing/licenses
 #include "Looting/ManagedLists.h"
 #include "Utilities/utils.h"
 
+#include <future>
+#include <thread>
+
 namespace shse
 {
 
@@ -43,17 +46,8 @@ PlacedObjects::PlacedObjects()
 {
 }
 
-// record all the Placed instances, so we can validate Quest Targets later
-void PlacedObjects::RecordPlacedItem(const RE::TESForm* item, const RE::TESObjectREFR* refr)
-{
-	m_placedItems.insert(item);
-	if (m_placedObjects[item].insert(refr).second)
-	{
-		REL_VMESSAGE("REFR 0x{:08x} to item {}/0x{:08x} is a Placed Object", refr->GetFormID(), item->GetName(), item->GetFormID());
-	}
-}
-
-void PlacedObjects::SaveREFRIfPlaced(const RE::TESObjectREFR* refr)
+// list the items this REFR places, so we can validate Quest Targets later - may contain duplicates for a Container
+void PlacedObjects::SaveREFRIfPlaced(const RE::TESObjectREFR* refr, std::vector<const RE::TESForm*>& items) const
 {
 	// skip if empty REFR
 	if (!refr)
@@ -112,7 +106,7 @@ void PlacedObjects::SaveREFRIfPlaced(const RE::TESObjectREFR* refr)
 			}
 			else
 			{
-				RecordPlacedItem(entryContents, refr);
+				items.push_back(entryContents);
 			}
 			// continue the scan
 			return true;
@@ -120,32 +114,51 @@ void PlacedObjects::SaveREFRIfPlaced(const RE::TESObjectREFR* refr)
 	}
 	else
 	{
-		RecordPlacedItem(refr->GetBaseObject(), refr);
+		items.push_back(refr->GetBaseObject());
 	}
 }
 
-// This logic works at startup for non-Masters. If the REFR is from a master, temp REFRs are loaded on demand and we could
-// check again then.
-void PlacedObjects::RecordPlacedObjectsForCell(const RE::TESObjectCELL* cell)
+bool PlacedObjects::IsCellScannable(const RE::TESObjectCELL* cell) const
 {
-	if (!m_checkedForPlacedObjects.insert(cell).second)
-		return;
-
 	if (ManagedList::BlackList().Contains(cell))
-		return;
+		return false;
 
 	if (DataCase::GetInstance()->IsOffLimitsLocation(cell))
-		return;
+		return false;
+	return true;
+}
+
+// This logic works at startup for non-Masters. If the REFR is from a master, temp REFRs are loaded on demand and we could
+// check again then.
+PlacedObjects::PlacedCounts PlacedObjects::RecordPlacedObjectsForCells(const std::vector<const RE::TESObjectCELL*>& cells,
+	const size_t begin, const size_t end) const
+{
+	PlacedCounts counts;
+	std::vector<const RE::TESForm*> items;
+	for (size_t index = begin; index < end; ++index)
+	{
+		const RE::TESObjectCELL* cell(cells[index]);
 #if _DEBUG
-	ptrdiff_t actors(std::count_if(cell->references.cbegin(), cell->references.cend(),
-		[&](const auto refr) -> bool { return refr->GetFormType() == RE::FormType::ActorCharacter; }));
-	DBG_MESSAGE("Process {} REFRs including {} actors in CELL {}/0x{:08x}", cell->references.size(), actors, FormUtils::SafeGetFormEditorID(cell).c_str(), cell->GetFormID());
+		ptrdiff_t actors(std::count_if(cell->references.cbegin(), cell->references.cend(),
+			[&](const auto refr) -> bool { return refr->GetFormType() == RE::FormType::ActorCharacter; }));
+		DBG_MESSAGE("Process {} REFRs including {} actors in CELL {}/0x{:08x}", cell->references.size(), actors, FormUtils::SafeGetFormEditorID(cell).c_str(), cell->GetFormID());
 #endif
-	for (const RE::TESObjectREFRPtr& refptr : cell->references)
-	{
-		const RE::TESObjectREFR* refr(refptr.get());
-		SaveREFRIfPlaced(refr);
+		for (const RE::TESObjectREFRPtr& refptr : cell->references)
+		{
+			const RE::TESObjectREFR* refr(refptr.get());
+			items.clear();
+			SaveREFRIfPlaced(refr, items);
+			// each REFR counts once per item, however many Container entries list it
+			std::sort(items.begin(), items.end());
+			items.erase(std::unique(items.begin(), items.end()), items.end());
+			for (const RE::TESForm* item : items)
+			{
+				++counts[item];
+				REL_VMESSAGE("REFR 0x{:08x} to item {}/0x{:08x} is a Placed Object", refr->GetFormID(), item->GetName(), item->GetFormID());
+			}
+		}
 	}
+	return counts;
 }
 
 void PlacedObjects::RecordPlacedObjects(void)
@@ -154,24 +167,68 @@ void PlacedObjects::RecordPlacedObjects(void)
 	WindowsUtils::ScopedTimer elapsed("Record Placed Objects");
 #endif
 
-	// Process CELLs to list all placed objects of interest for Quest Target checking
+	// List the CELLs to process once each, with their REFR counts so shards can be balanced by work rather than by CELL
+	std::vector<const RE::TESObjectCELL*> cells;
+	std::vector<size_t> refrTotals;
+	std::unordered_set<const RE::TESObjectCELL*> listed;
+	size_t refrs(0);
+	const auto listCell = [&](const RE::TESObjectCELL* cell) {
+		if (!cell || !listed.insert(cell).second || !IsCellScannable(cell))
+			return;
+		cells.push_back(cell);
+		refrs += cell->references.size();
+		refrTotals.push_back(refrs);
+	};
 	for (const auto worldSpace : RE::TESDataHandler::GetSingleton()->GetFormArray<RE::TESWorldSpace>())
 	{
 		DBG_MESSAGE("Process {} CELLs in WorldSpace Map for {}/0x{:08x}", worldSpace->cellMap.size(), worldSpace->GetName(), worldSpace->GetFormID());
 		for (const auto cellEntry : worldSpace->cellMap)
 		{
-			RecordPlacedObjectsForCell(cellEntry.second);
+			listCell(cellEntry.second);
 		}
 	}
 	DBG_MESSAGE("Process {} Interior CELLs", RE::TESDataHandler::GetSingleton()->interiorCells.size());
 	for (const auto cell : RE::TESDataHandler::GetSingleton()->interiorCells)
 	{
-		RecordPlacedObjectsForCell(cell);
+		listCell(cell);
+	}
+
+	// Process contiguous CELL ranges in parallel, each range holding about the same number of REFRs
+	const size_t shards(std::max(size_t(1), std::min({ MaxScanShards, size_t(std::thread::hardware_concurrency()), cells.size() })));
+	std::vector<std::future<PlacedCounts>> pending;
+	pending.reserve(shards);
+	size_t begin(0);
+	for (size_t shard = 1; shard <= shards; ++shard)
+	{
+		const size_t end(shard == shards ? cells.size() : size_t(std::upper_bound(refrTotals.cbegin(), refrTotals.cend(),
+			refrs * shard / shards) - refrTotals.cbegin()));
+		if (end <= begin)
+			continue;
+		DBG_MESSAGE("Shard {} processes CELLs [{}, {})", shard, begin, end);
+		pending.push_back(std::async(std::launch::async, &PlacedObjects::RecordPlacedObjectsForCells, this, std::cref(cells), begin, end));
+		begin = end;
+	}
+
+	RecursiveLockGuard guard(m_placedLock);
+	m_placedObjects.clear();
+	for (auto& shard : pending)
+	{
+		PlacedCounts counts(shard.get());
+		if (m_placedObjects.empty())
+		{
+			m_placedObjects.swap(counts);
+			continue;
+		}
+		for (const auto& itemCount : counts)
+		{
+			m_placedObjects[itemCount.first] += itemCount.second;
+		}
 	}
 	size_t placed(0);
 	placed = std::accumulate(m_placedObjects.cbegin(), m_placedObjects.cend(), placed,
-		[&] (const size_t& result, const auto& keyList) { return result + keyList.second.size(); });
-	REL_MESSAGE("{} Placed Objects recorded for {} Items", placed, m_placedItems.size());
+		[&] (const size_t& result, const auto& itemCount) { return result + itemCount.second; });
+	REL_MESSAGE("{} Placed Objects recorded for {} Items from {} REFRs in {} CELLs, {} shards", placed, m_placedObjects.size(),
+		refrs, cells.size(), pending.size());
 }
 
 size_t PlacedObjects::NumberOfInstances(const RE::TESForm* form) const
@@ -180,7 +237,7 @@ size_t PlacedObjects::NumberOfInstances(const RE::TESForm* form) const
 	const auto& matched(m_placedObjects.find(form));
 	if (matched != m_placedObjects.cend())
 	{
-		return matched->second.size();
+		return matched->second;
 	}
 	return 0;
 }
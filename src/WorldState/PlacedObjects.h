@@ -32,16 +32,20 @@ public:
 	size_t NumberOfInstances(const RE::TESForm* form) const;
 
 private:
-	void RecordPlacedItem(const RE::TESForm* item, const RE::TESObjectREFR* refr);
-	void SaveREFRIfPlaced(const RE::TESObjectREFR* refr);
-	void RecordPlacedObjectsForCell(const RE::TESObjectCELL* cell);
+	// count of distinct placed REFRs for each item - scan shards tally privately, then merge
+	typedef std::unordered_map<const RE::TESForm*, uint32_t> PlacedCounts;
+
+	void SaveREFRIfPlaced(const RE::TESObjectREFR* refr, std::vector<const RE::TESForm*>& items) const;
+	bool IsCellScannable(const RE::TESObjectCELL* cell) const;
+	PlacedCounts RecordPlacedObjectsForCells(const std::vector<const RE::TESObjectCELL*>& cells,
+		const size_t begin, const size_t end) const;
 
 	static std::unique_ptr<PlacedObjects> m_instance;
 	mutable RecursiveLock m_placedLock;
 
-	std::unordered_set<const RE::TESForm*> m_placedItems;
-	std::unordered_map<const RE::TESForm*, std::set<const RE::TESObjectREFR*>> m_placedObjects;
-	std::unordered_set<const RE::TESObjectCELL*> m_checkedForPlacedObjects;
+	// game data is read-only while we scan, so shards need no shared state
+	static constexpr size_t MaxScanShards = 8;
+	PlacedCounts m_placedObjects;
 };
 
 }
@@ -54,18 +54,25 @@ void PlayerHouses::Clear()
 	RecursiveLockGuard guard(m_housesLock);
 	m_houses.clear();
 	m_houseCells.clear();
+	++m_generation;
 }
 
 bool PlayerHouses::Add(const RE::BGSLocation* location)
 {
 	RecursiveLockGuard guard(m_housesLock);
-	return location && m_houses.insert(location->GetFormID()).second;
+	if (!location || !m_houses.insert(location->GetFormID()).second)
+		return false;
+	++m_generation;
+	return true;
 }
 
 bool PlayerHouses::AddCell(const RE::FormID cellID)
 {
 	RecursiveLockGuard guard(m_housesLock);
-	return cellID != InvalidForm && m_houseCells.insert(cellID).second;
+	if (cellID == InvalidForm || !m_houseCells.insert(cellID).second)
+		return false;
+	++m_generation;
+	return true;
 }
 
 // Check indeterminate status of the location, because a requested UI check is pending
@@ -19,6 +19,8 @@ http://www.fsf.org/licensing/licenses
 *************************************************************************/
 #pragma once
 
+#include <atomic>
+
 namespace shse
 {
 
@@ -33,6 +35,8 @@ public:
 	bool AddCell(const RE::FormID cellID);
 	bool Contains(const RE::BGSLocation* location) const;
 	bool ContainsCell(const RE::FormID cellID) const;
+	// advances whenever the set of known houses changes
+	inline uint64_t Generation() const { return m_generation; }
 
 	void SetKeyword(RE::BGSKeyword* keyword);
 	void SetCell(const RE::TESObjectCELL* houseCell);
@@ -50,6 +54,7 @@ private:
 	// CELLS that are effectively player house but not in a properly-tagged LCTN
 	std::unordered_set<RE::FormID> m_validHouseCells;
 	mutable RecursiveLock m_housesLock;
+	std::atomic<uint64_t> m_generation = 0;
 };
 
 }
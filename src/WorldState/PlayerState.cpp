@@ -21,6 +21,7 @@ http://www.fsf.org/licensing/licenses
 
 #include "WorldState/PlayerState.h"
 #include "WorldState/GameCalendar.h"
+#include "Collections/CollectionManager.h"
 #include "Data/DataCase.h"
 #include "Data/LoadOrder.h"
 #include "Data/SettingsCache.h"
@@ -83,6 +84,7 @@ void PlayerState::Refresh(const bool onMCMPush, const bool onGameReload)
 		// reset carry weight state and recache settings
 		ResetCarryWeight();
 		SettingsCache::Instance().Refresh();
+		CollectionManager::Instance().RefreshSettings();
 	}
 	else
 	{
@@ -359,7 +361,7 @@ const RE::TESRace* PlayerState::GetRace() const
 	return player->GetRace();
 }
 
-AlglibPosition PlayerState::GetAlglibPosition() const
+DoublePosition PlayerState::GetDoublePosition() const
 {
 	const auto player(RE::PlayerCharacter::GetSingleton());
 	return { player->GetPositionX(), player->GetPositionY(), player->GetPositionZ() };
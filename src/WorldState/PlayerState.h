@@ -44,7 +44,7 @@ public:
 	void ExcludeMountedIfForbidden(void);
 	Position GetPosition() const;
 	const RE::TESRace* GetRace() const;
-	AlglibPosition GetAlglibPosition() const;
+	DoublePosition GetDoublePosition() const;
 	bool WithinDetectionRange(const double distance) const;
 	void UpdateGameTime(const float gameTime);
 	inline float CurrentGameTime() const { return m_gameTime; }
@@ -25,18 +25,18 @@ namespace shse
 
 // x, y, z coordinates
 typedef std::array<float, 3> Position;
-typedef std::array<double, 3> AlglibPosition;
+typedef std::array<double, 3> DoublePosition;
 
 constexpr Position InvalidPosition = { 0.0, 0.0, 0.0 };
 
 class RelativeLocationDescriptor
 {
 public:
-	RelativeLocationDescriptor(const AlglibPosition startPoint, const AlglibPosition endPoint, const RE::FormID locationID, const double unitsAway) :
+	RelativeLocationDescriptor(const DoublePosition startPoint, const DoublePosition endPoint, const RE::FormID locationID, const double unitsAway) :
 		m_startPoint(startPoint), m_endPoint(endPoint), m_locationID(locationID), m_unitsAway(unitsAway)
 	{}
-	inline AlglibPosition StartPoint() const { return m_startPoint; }
-	inline AlglibPosition EndPoint() const { return m_endPoint; }
+	inline DoublePosition StartPoint() const { return m_startPoint; }
+	inline DoublePosition EndPoint() const { return m_endPoint; }
 	inline RE::FormID LocationID() const { return m_locationID; }
 	inline double UnitsAway() const { return m_unitsAway; }
 	static RelativeLocationDescriptor Invalid() { return RelativeLocationDescriptor({ 0.,0.,0. }, { 0.,0.,0. }, 0, 0.0); }
@@ -45,8 +45,8 @@ public:
 	}
 
 private:
-	const AlglibPosition m_startPoint;
-	const AlglibPosition m_endPoint;
+	const DoublePosition m_startPoint;
+	const DoublePosition m_endPoint;
 	const RE::FormID m_locationID;	// represents end point
 	const double m_unitsAway;
 };
@@ -37,7 +37,7 @@ Saga& Saga::Instance()
 	return *m_instance;
 }
 
-Saga::Saga() : m_currentPageLength(0), m_hasContent(false)
+Saga::Saga() : m_epoch(0), m_currentDay(NoDay), m_currentPageLength(0), m_hasContent(false)
 {
 }
 
@@ -46,39 +46,38 @@ void Saga::Reset()
 	RecursiveLockGuard guard(m_sagaLock);
 	m_daysWithEvents.clear();
 	m_eventsByDay.clear();
-	m_currentDayPages.clear();
+	m_currentDay = NoDay;
+	++m_epoch;
+}
+
+void Saga::AddSagaEvent(const float gameTime, SagaEvent&& event)
+{
+	const unsigned int elapsedDays(static_cast<unsigned int>(std::floor(gameTime)));
+	const unsigned int minute(GameCalendar::Instance().DayPartInMinutes(gameTime));
+	RecursiveLockGuard guard(m_sagaLock);
+	if (elapsedDays + 1 > m_eventsByDay.size())
+	{
+		m_eventsByDay.resize(elapsedDays + 1);
+	}
+	SagaDay& day(m_eventsByDay[elapsedDays]);
+	if (day.m_events.empty())
+	{
+		// events arrive in time order during play and cosave load, so this is almost always an append
+		m_daysWithEvents.insert(std::upper_bound(m_daysWithEvents.cbegin(), m_daysWithEvents.cend(), elapsedDays), elapsedDays);
+	}
+	// equal times keep insertion order
+	day.m_events.insert({ minute, std::move(event) });
+	++day.m_revision;
 }
 
 size_t Saga::DaysWithEvents() const
 {
 	RecursiveLockGuard guard(m_sagaLock);
-	m_daysWithEvents.clear();
-	m_daysWithEvents.reserve(m_eventsByDay.size());
-	unsigned int index(0);
-	ptrdiff_t count(std::count_if(m_eventsByDay.cbegin(), m_eventsByDay.cend(),
-		[&](const std::vector<SagaEvent>& events) -> bool {
-		if (!events.empty())
-		{
-			m_daysWithEvents.push_back({ index, {} });
-			++index;
-			// sort each day's events by time before we render the events as text. This view on the current dataset is used to display text in MCM.
-			auto& sortedEvents = m_daysWithEvents.back().second;
-			std::for_each(events.cbegin(), events.cend(), [&](const SagaEvent& event) {
-				sortedEvents.insert({ std::visit([&] (auto const& e) { return GameCalendar::Instance().DayPartInMinutes(e.GameTime()); }, event), event });
-			});
-			return true;
-		}
-		else
-		{
-			++index;
-			return false;
-		}
-	}));
-	DBG_MESSAGE("Days with events {}", count);
-	return static_cast<size_t>(count);
+	DBG_MESSAGE("Days with events {}", m_daysWithEvents.size());
+	return m_daysWithEvents.size();
 }
 
-void Saga::AddPaginatedText(std::ostringstream& page, const std::string& text, const bool skipIfNewPage) const
+void Saga::AddPaginatedText(std::vector<std::string>& pages, std::ostringstream& page, const std::string& text, const bool skipIfNewPage) const
 {
 	if (text.empty())
 		return;
@@ -88,7 +87,7 @@ void Saga::AddPaginatedText(std::ostringstream& page, const std::string& text, c
 	{
 		if (skipIfNewPage)
 			return;
-		FlushPaginatedText(page);
+		FlushPaginatedText(pages, page);
 	}
 	page << text;
 	m_currentPageLength += text.length();
@@ -98,15 +97,15 @@ void Saga::AddPaginatedText(std::ostringstream& page, const std::string& text, c
 	}
 }
 
-void Saga::FlushPaginatedText(std::ostringstream& page) const
+void Saga::FlushPaginatedText(std::vector<std::string>& pages, std::ostringstream& page) const
 {
 	if (m_currentPageLength > 0 && m_hasContent)
 	{
 		page << std::ends;		// terminate text we wrote for use with str()
 		std::string pageStr(page.str());
 		pageStr.resize(m_currentPageLength);
-		m_currentDayPages.push_back(pageStr);
-		DBG_MESSAGE("Flushed page {}\n{}", m_currentDayPages.size(), page.str());
+		pages.push_back(pageStr);
+		DBG_MESSAGE("Flushed page {}\n{}", pages.size(), page.str());
 
 		// see https://stackoverflow.com/questions/624260/how-to-reuse-an-ostringstream including comments
 		page.seekp(0);			// seek put ptr to start - no reallocation unless next page has more text
@@ -115,72 +114,117 @@ void Saga::FlushPaginatedText(std::ostringstream& page) const
 	}
 }
 
+// Selects the day whose pages MCM reads next. Pages are rendered on demand.
 std::string Saga::DateStringByIndex(const unsigned int dayIndex) const
 {
 	RecursiveLockGuard guard(m_sagaLock);
 	if (dayIndex - 1 < m_daysWithEvents.size())
 	{
-		// seed freeform text pages for this day's events. Text is stateful for some events.
-		AdventureEvent::ResetSagaState();
-		VisitedPlace::ResetSagaState();
-		m_currentDayPages.clear();
-		const auto& sortedEvents = m_daysWithEvents[dayIndex - 1].second;
-		unsigned int currentMinute(0);
-		bool first(true);
-		std::ostringstream thisPage;
-		m_currentPageLength = 0;
-		for (const auto timeEvent : sortedEvents)
+		m_currentDay = m_daysWithEvents[dayIndex - 1];
+		return GameCalendar::Instance().DateString(m_currentDay);
+	}
+	m_currentDay = NoDay;
+	return "";
+}
+
+// Render the selected day's pages unless the cached pages are up to date. Event text can call into other subsystems
+// whose callers add Saga events under their own locks, so rendering works on a snapshot outside our lock.
+void Saga::RefreshCurrentDayPages() const
+{
+	TimedEvents events;
+	uint64_t revision(0);
+	uint64_t epoch(0);
+	unsigned int dayNumber(NoDay);
+	{
+		RecursiveLockGuard guard(m_sagaLock);
+		if (m_currentDay >= m_eventsByDay.size())
+			return;
+		const SagaDay& day(m_eventsByDay[m_currentDay]);
+		if (day.m_renderedRevision == day.m_revision)
 		{
-			// check if event has anything to output
-			std::string eventStr(std::visit([&](auto const& e) { return e.AsString(); }, timeEvent.second));
-			if (!eventStr.empty())
+			DBG_MESSAGE("Day {} has {} cached pages", m_currentDay, day.m_pages.size());
+			return;
+		}
+		dayNumber = m_currentDay;
+		revision = day.m_revision;
+		epoch = m_epoch;
+		events.assign(day.m_events.cbegin(), day.m_events.cend());
+	}
+	std::vector<std::string> pages(RenderPages(events));
+
+	RecursiveLockGuard guard(m_sagaLock);
+	// the Saga may have been reset, and even refilled to this day from another save, while we rendered
+	if (epoch != m_epoch || dayNumber >= m_eventsByDay.size())
+		return;
+	const SagaDay& day(m_eventsByDay[dayNumber]);
+	day.m_pages.swap(pages);
+	// if the day gained events meanwhile, the revisions differ and the next request renders again
+	day.m_renderedRevision = revision;
+	DBG_MESSAGE("Day {} has {} pages for {} events", dayNumber, day.m_pages.size(), events.size());
+}
+
+std::vector<std::string> Saga::RenderPages(const TimedEvents& sortedEvents) const
+{
+	// seed freeform text pages for this day's events. Text is stateful for some events.
+	AdventureEvent::ResetSagaState();
+	VisitedPlace::ResetSagaState();
+	std::vector<std::string> pages;
+	unsigned int currentMinute(0);
+	bool first(true);
+	std::ostringstream thisPage;
+	m_currentPageLength = 0;
+	m_hasContent = false;
+	for (const auto& timeEvent : sortedEvents)
+	{
+		// check if event has anything to output
+		std::string eventStr(std::visit([&](auto const& e) { return e.AsString(); }, timeEvent.second));
+		if (!eventStr.empty())
+		{
+			if (first || currentMinute != timeEvent.first)
 			{
-				if (first || currentMinute != timeEvent.first)
-				{
-					// add newline for new paragraph if this is a time change - not needed if this forces new page
-					if (!first)
-					{
-						AddPaginatedText(thisPage, "\n", true);
-					}
-					first = false;
-					currentMinute = timeEvent.first;
-					// timestamp and first entry need to be on the same page
-					std::string timestampedEvent(GameCalendar::Instance().TimeString(currentMinute));
-					timestampedEvent.append(" ");
-					timestampedEvent.append(eventStr);
-					AddPaginatedText(thisPage, timestampedEvent, false);
-				}
-				else
+				// add newline for new paragraph if this is a time change - not needed if this forces new page
+				if (!first)
 				{
-					AddPaginatedText(thisPage, " ", true);
-					AddPaginatedText(thisPage, eventStr, false);
+					AddPaginatedText(pages, thisPage, "\n", true);
 				}
+				first = false;
+				currentMinute = timeEvent.first;
+				// timestamp and first entry need to be on the same page
+				std::string timestampedEvent(GameCalendar::Instance().TimeString(currentMinute));
+				timestampedEvent.append(" ");
+				timestampedEvent.append(eventStr);
+				AddPaginatedText(pages, thisPage, timestampedEvent, false);
+			}
+			else
+			{
+				AddPaginatedText(pages, thisPage, " ", true);
+				AddPaginatedText(pages, thisPage, eventStr, false);
 			}
 		}
-		FlushPaginatedText(thisPage);
-
-		DBG_MESSAGE("Current day has {} pages for {} events", m_currentDayPages.size(),sortedEvents.size());
-		return GameCalendar::Instance().DateString(m_daysWithEvents[dayIndex - 1].first);
 	}
-	return "";
+	FlushPaginatedText(pages, thisPage);
+	return pages;
 }
 
 // Relies on context set by last call to DateStringByIndex
 size_t Saga::CurrentDayPageCount() const
 {
+	RefreshCurrentDayPages();
 	RecursiveLockGuard guard(m_sagaLock);
-	DBG_MESSAGE("{} pages available", m_currentDayPages.size());
-	return m_currentDayPages.size();
+	const size_t pages(m_currentDay < m_eventsByDay.size() ? m_eventsByDay[m_currentDay].m_pages.size() : 0);
+	DBG_MESSAGE("{} pages available", pages);
+	return pages;
 }
 
 std::string Saga::PageByNumber(const unsigned int pageNumber) const
 {
+	RefreshCurrentDayPages();
 	RecursiveLockGuard guard(m_sagaLock);
 	std::string result;
 	// use 1-based MCM offset, 0-based vector offset
-	if (pageNumber <= m_currentDayPages.size())
+	if (m_currentDay < m_eventsByDay.size() && pageNumber - 1 < m_eventsByDay[m_currentDay].m_pages.size())
 	{
-		result = m_currentDayPages[pageNumber-1];
+		result = m_eventsByDay[m_currentDay].m_pages[pageNumber - 1];
 	}
 	DBG_MESSAGE("Saga page {} =\n{}", pageNumber, result);
 	return result;
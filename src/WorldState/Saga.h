@@ -46,25 +46,39 @@ public:
 	template <typename EVENTTYPE>
 	void AddEvent(const EVENTTYPE& event)
 	{
-		size_t elapsedDays(static_cast<size_t>(std::floor(event.GameTime())));
-		if (elapsedDays+1 > m_eventsByDay.size())
-		{
-			m_eventsByDay.resize(elapsedDays+1);
-		}
-		m_eventsByDay[elapsedDays].push_back(SagaEvent(event));
+		AddSagaEvent(event.GameTime(), SagaEvent(event));
 	}
 
 private:
-	void AddPaginatedText(std::ostringstream& page, const std::string& text, const bool skipIfNewPage) const;
-	void FlushPaginatedText(std::ostringstream& page) const;
+	// One day's events ordered by time of day in minutes. Rendered pages are kept until the day gains more events.
+	struct SagaDay
+	{
+		std::multimap<unsigned int, SagaEvent> m_events;
+		uint64_t m_revision = 0;
+		mutable uint64_t m_renderedRevision = 0;
+		mutable std::vector<std::string> m_pages;
+	};
+	typedef std::vector<std::pair<unsigned int, SagaEvent>> TimedEvents;
+
+	void AddSagaEvent(const float gameTime, SagaEvent&& event);
+	void RefreshCurrentDayPages() const;
+	std::vector<std::string> RenderPages(const TimedEvents& events) const;
+	void AddPaginatedText(std::vector<std::string>& pages, std::ostringstream& page, const std::string& text, const bool skipIfNewPage) const;
+	void FlushPaginatedText(std::vector<std::string>& pages, std::ostringstream& page) const;
+
+	static constexpr unsigned int NoDay = std::numeric_limits<unsigned int>::max();
 
 	static std::unique_ptr<Saga> m_instance;
 	mutable RecursiveLock m_sagaLock;
 	// persistent record of events on each day
-	std::vector<std::vector<SagaEvent>> m_eventsByDay;
-	// transient view used to map MCM Input day number to that day's events - ordered by time of day in minutes
-	mutable std::vector<std::pair<unsigned int, std::multimap<unsigned int, SagaEvent>>> m_daysWithEvents;
-	mutable std::vector<std::string> m_currentDayPages;
+	std::vector<SagaDay> m_eventsByDay;
+	// days that have events in ascending order, maintained as events are added - maps MCM Input day number to the day
+	std::vector<unsigned int> m_daysWithEvents;
+	// advances on Reset, so pages rendered from a discarded Saga are never stored
+	uint64_t m_epoch;
+	// day selected in MCM
+	mutable unsigned int m_currentDay;
+	// pagination state while rendering, only used by the MCM thread
 	mutable size_t m_currentPageLength;
 	mutable bool m_hasContent;
 };
@@ -20,9 +20,12 @@ http://www.fsf.org/licensing/licenses
 #include "PrecompiledHeaders.h"
 
 #include "WorldState/VisitedPlaces.h"
+#include "WorldState/AdventureTargets.h"
 #include "WorldState/PlayerState.h"
 #include "WorldState/Saga.h"
+#include "Data/CosaveData.h"
 #include "Data/LoadOrder.h"
+#include "Data/SettingsCache.h"
 
 namespace shse
 {
@@ -89,7 +92,7 @@ std::string VisitedPlace::AsString() const
 		// event between locations: print position info relative to nearby Location
 		static const bool historic(true);
 		std::string locationStr(LocationTracker::Instance().LocationRelativeToNearestMapMarker(
-			AlglibPosition({ m_position[0], m_position[1], m_position[2] }), true));
+			DoublePosition({ m_position[0], m_position[1], m_position[2] }), true));
 		if (locationStr.empty())
 		{
 			stream << "I was exploring";
@@ -144,6 +147,70 @@ void to_json(nlohmann::json& j, const VisitedPlace& visitedPlace)
 	visitedPlace.AsJSON(j);
 }
 
+VisitedDay::VisitedDay(const unsigned int day) : m_day(day), m_sealed(false)
+{
+}
+
+void VisitedDay::Append(const VisitedPlace& visit)
+{
+	m_visits.push_back(visit);
+}
+
+void VisitedDay::Seal(const bool compact)
+{
+	if (m_sealed)
+		return;
+	m_sealed = true;
+	if (compact)
+	{
+		// Moving between CELLs within one Location produces no Saga text, so only the entry into the Location is kept.
+		// Exploration outside any Location is kept in full, it is narrated relative to the nearest map marker.
+		const size_t before(m_visits.size());
+		std::vector<VisitedPlace> compacted;
+		compacted.reserve(before);
+		for (const VisitedPlace& visit : m_visits)
+		{
+			if (!compacted.empty() && visit.Location() && visit.Location() == compacted.back().Location() &&
+				visit.Worldspace() == compacted.back().Worldspace())
+				continue;
+			compacted.push_back(visit);
+		}
+		compacted.shrink_to_fit();
+		m_visits.swap(compacted);
+		DBG_MESSAGE("Day {} sealed, {} visits compacted to {}", m_day, before, m_visits.size());
+	}
+}
+
+void VisitedDay::AsJSON(nlohmann::json& visits) const
+{
+	for (const VisitedPlace& visit : m_visits)
+	{
+		visits.push_back(visit);
+	}
+}
+
+// runs without the VisitedPlaces lock, on a copy of the visits
+bool VisitedDay::EncodeChunk(const uint32_t tag, const std::vector<VisitedPlace>& visits, std::string& chunk, size_t& plainLength)
+{
+	nlohmann::json j;
+	j["visited"] = nlohmann::json::array();
+	nlohmann::json& visited(j["visited"]);
+	for (const VisitedPlace& visit : visits)
+	{
+		visited.push_back(visit);
+	}
+	return CosaveData::EncodeChunk(tag, j, chunk, plainLength);
+}
+
+// caller holds VisitedPlaces lock
+void VisitedDay::SetEncoded(std::shared_ptr<const std::string> encoded) const
+{
+	if (m_sealed && !m_encoded)
+	{
+		m_encoded = std::move(encoded);
+	}
+}
+
 std::unique_ptr<VisitedPlaces> VisitedPlaces::m_instance;
 
 VisitedPlaces& VisitedPlaces::Instance()
@@ -162,7 +229,14 @@ VisitedPlaces::VisitedPlaces()
 void VisitedPlaces::Reset()
 {
 	RecursiveLockGuard guard(m_visitedLock);
-	m_visited.clear();
+	m_days.clear();
+	++m_historyVersion;
+	++m_generation;
+}
+
+unsigned int VisitedPlaces::DayOf(const float gameTime)
+{
+	return static_cast<unsigned int>(std::floor(std::max(gameTime, 0.0f)));
 }
 
 void VisitedPlaces::RecordVisit(const RE::TESWorldSpace* worldspace, const RE::BGSLocation* location, const RE::FormID cellID,
@@ -170,23 +244,31 @@ void VisitedPlaces::RecordVisit(const RE::TESWorldSpace* worldspace, const RE::B
 {
 	bool isNew(false);
 	RecursiveLockGuard guard(m_visitedLock);
-	if (m_visited.empty())
+	if (m_days.empty())
 	{
 		isNew = true;
 	}
 	else
 	{
-		const VisitedPlace& currentPlace(m_visited.back());
+		const VisitedPlace& currentPlace(m_days.back().Visits().back());
 		isNew = worldspace != currentPlace.Worldspace() || location != currentPlace.Location() || cellID != currentPlace.CellID();
 	}
 	if (isNew)
-	{ 
-		m_visited.emplace_back(worldspace, location, cellID, position, gameTime);
-		Saga::Instance().AddEvent(m_visited.back());
-		if (location)
+	{
+		// game time does not run backwards in one playthrough, but never reopen a sealed day if it did
+		const unsigned int day(DayOf(gameTime));
+		if (m_days.empty() || day > m_days.back().Day())
 		{
-			m_knownLocations.insert(location);
+			if (!m_days.empty())
+			{
+				m_days.back().Seal(SettingsCache::Instance().CompactVisitedPlaces());
+			}
+			m_days.emplace_back(day);
 		}
+		m_days.back().Append(VisitedPlace(worldspace, location, cellID, position, gameTime));
+		++m_generation;
+		Saga::Instance().AddEvent(m_days.back().Visits().back());
+		MarkKnown(location);
 	}
 }
 
@@ -194,19 +276,98 @@ void VisitedPlaces::AsJSON(nlohmann::json& j) const
 {
 	RecursiveLockGuard guard(m_visitedLock);
 	j["visited"] = nlohmann::json::array();
-	for (const auto& visited : m_visited)
+	nlohmann::json& visits(j["visited"]);
+	for (const auto& day : m_days)
 	{
-		j["visited"].push_back(visited);
+		day.AsJSON(visits);
 	}
 }
 
+// One chunk per game day, oldest first - sealed days are encoded at most once. Only the encoded chunks and a copy of
+// the visits still to encode are taken under the lock. After a game load that is the whole history, so compression
+// runs after releasing it and RecordVisit on the scan thread is not held up.
+bool VisitedPlaces::EncodeChunks(const uint32_t tag, std::string& record) const
+{
+	struct DayChunk {
+		unsigned int m_day;
+		bool m_sealed;
+		std::shared_ptr<const std::string> m_encoded;
+		std::vector<VisitedPlace> m_visits;
+	};
+	const auto startTime(std::chrono::high_resolution_clock::now());
+	std::vector<DayChunk> chunks;
+	uint64_t historyVersion(0);
+	{
+		RecursiveLockGuard guard(m_visitedLock);
+		historyVersion = m_historyVersion;
+		chunks.reserve(m_days.size());
+		for (const auto& day : m_days)
+		{
+			std::shared_ptr<const std::string> encoded(day.IsSealed() ? day.Encoded() : nullptr);
+			chunks.push_back({ day.Day(), day.IsSealed(), encoded, encoded ? std::vector<VisitedPlace>() : day.Visits() });
+		}
+	}
+	if (chunks.empty())
+	{
+		// an empty history is still a well-formed record, holding one empty open day
+		chunks.push_back({ 0, false, nullptr, std::vector<VisitedPlace>() });
+	}
+	std::vector<DayChunk*> newlySealed;
+	size_t newlyEncoded(0);
+	size_t plainLength(0);
+	for (auto& chunk : chunks)
+	{
+		if (!chunk.m_encoded)
+		{
+			std::string encoded;
+			if (!VisitedDay::EncodeChunk(tag, chunk.m_visits, encoded, plainLength))
+				return false;
+			++newlyEncoded;
+			chunk.m_encoded = std::make_shared<const std::string>(std::move(encoded));
+			if (chunk.m_sealed)
+			{
+				newlySealed.push_back(&chunk);
+			}
+		}
+		CosaveData::AppendChunk(record, *chunk.m_encoded);
+	}
+	if (!newlySealed.empty())
+	{
+		// sealed days never change, so the chunk is kept unless the history was replaced meanwhile
+		RecursiveLockGuard guard(m_visitedLock);
+		if (historyVersion == m_historyVersion)
+		{
+			for (const DayChunk* chunk : newlySealed)
+			{
+				const auto day(std::lower_bound(m_days.cbegin(), m_days.cend(), chunk->m_day,
+					[](const VisitedDay& visitedDay, const unsigned int target) -> bool { return visitedDay.Day() < target; }));
+				if (day != m_days.cend() && day->Day() == chunk->m_day)
+				{
+					day->SetEncoded(chunk->m_encoded);
+				}
+			}
+		}
+	}
+	REL_MESSAGE("Encoded {} record {} day chunks, {} new from {} bytes, {} bytes in {} microseconds", CosaveData::RecordTagName(tag),
+		chunks.size(), newlyEncoded, plainLength, record.length(),
+		std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - startTime).count());
+	return true;
+}
+
 // rehydrate from cosave data
 void VisitedPlaces::UpdateFrom(const nlohmann::json& j)
 {
 	REL_MESSAGE("Cosave Visited Places\n{}", j.dump(2));
 	RecursiveLockGuard guard(m_visitedLock);
-	m_visited.clear();
-	m_visited.reserve(j["visited"].size());
+	Reset();
+	AppendFrom(j);
+}
+
+// rehydrate one chunk of cosave data, visits later than those already recorded
+void VisitedPlaces::AppendFrom(const nlohmann::json& j)
+{
+	DBG_MESSAGE("Cosave Visited Places chunk\n{}", j.dump(2));
+	RecursiveLockGuard guard(m_visitedLock);
 	for (const nlohmann::json& place : j["visited"])
 	{
 		const float gameTime(place["time"].get<float>());
@@ -231,10 +392,16 @@ void VisitedPlaces::UpdateFrom(const nlohmann::json& j)
 			LoadOrder::Instance().MapCosaveFormID(StringUtils::ToFormID(cell->get<std::string>()), modMaskHint) : InvalidForm);
 		// the list was ordered by game time before saving - player position recorded
 		RecordVisit(worldspaceForm, locationForm, cellFormID, Position(place["position"]), gameTime);
-		if (locationForm)
-		{
-			m_knownLocations.insert(locationForm);
-		}
+		MarkKnown(locationForm);
+	}
+}
+
+// caller holds m_visitedLock - lock order is always VisitedPlaces then AdventureTargets
+void VisitedPlaces::MarkKnown(const RE::BGSLocation* location)
+{
+	if (location && m_knownLocations.insert(location).second)
+	{
+		AdventureTargets::Instance().MarkVisited(location);
 	}
 }
 
@@ -244,6 +411,34 @@ bool VisitedPlaces::IsKnown(const RE::BGSLocation* location) const
 	return m_knownLocations.contains(location);
 }
 
+size_t VisitedPlaces::DaysWithVisits() const
+{
+	RecursiveLockGuard guard(m_visitedLock);
+	return m_days.size();
+}
+
+std::vector<VisitedPlace> VisitedPlaces::VisitsBetween(const float fromTime, const float toTime) const
+{
+	std::vector<VisitedPlace> visits;
+	if (toTime <= fromTime)
+		return visits;
+	RecursiveLockGuard guard(m_visitedLock);
+	const unsigned int lastDay(DayOf(toTime));
+	auto day(std::lower_bound(m_days.cbegin(), m_days.cend(), DayOf(fromTime),
+		[](const VisitedDay& visitedDay, const unsigned int target) -> bool { return visitedDay.Day() < target; }));
+	for (; day != m_days.cend() && day->Day() <= lastDay; ++day)
+	{
+		for (const VisitedPlace& visit : day->Visits())
+		{
+			if (visit.GameTime() >= fromTime && visit.GameTime() < toTime)
+			{
+				visits.push_back(visit);
+			}
+		}
+	}
+	return visits;
+}
+
 void to_json(nlohmann::json& j, const VisitedPlaces& visitedPlaces)
 {
 	visitedPlaces.AsJSON(j);
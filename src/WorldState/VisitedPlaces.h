@@ -19,6 +19,8 @@ http://www.fsf.org/licensing/licenses
 *************************************************************************/
 #pragma once
 
+#include <atomic>
+
 #include "WorldState/LocationTracker.h"
 
 namespace shse
@@ -52,6 +54,34 @@ private:
 
 void to_json(nlohmann::json& j, const VisitedPlace& visitedPlace);
 
+// Visits on one game day, in time order. Only the latest day is open for append. Earlier days are sealed - optionally
+// compacted, and encoded for the cosave once so a save does not re-encode the whole history. The encoded chunk is
+// shared so a save can copy it under the VisitedPlaces lock without copying the bytes.
+class VisitedDay
+{
+public:
+	VisitedDay(const unsigned int day);
+	inline unsigned int Day() const { return m_day; }
+	inline const std::vector<VisitedPlace>& Visits() const { return m_visits; }
+	inline bool IsSealed() const { return m_sealed; }
+
+	void Append(const VisitedPlace& visit);
+	void Seal(const bool compact);
+	// appends this day's visits to the JSON array
+	void AsJSON(nlohmann::json& visits) const;
+	// one chunk of a chunked cosave record, for visits copied out of a day
+	static bool EncodeChunk(const uint32_t tag, const std::vector<VisitedPlace>& visits, std::string& chunk, size_t& plainLength);
+	inline std::shared_ptr<const std::string> Encoded() const { return m_encoded; }
+	// keeps the encoded chunk of a sealed day for later saves
+	void SetEncoded(std::shared_ptr<const std::string> encoded) const;
+
+private:
+	unsigned int m_day;
+	std::vector<VisitedPlace> m_visits;
+	bool m_sealed;
+	mutable std::shared_ptr<const std::string> m_encoded;
+};
+
 class VisitedPlaces
 {
 public:
@@ -64,14 +94,28 @@ public:
 
 	void AsJSON(nlohmann::json& j) const;
 	void UpdateFrom(const nlohmann::json& j);
+	void AppendFrom(const nlohmann::json& j);
+	bool EncodeChunks(const uint32_t tag, std::string& record) const;
+	// advances whenever state saved to the cosave changes
+	inline uint64_t Generation() const { return m_generation; }
 
 	bool IsKnown(const RE::BGSLocation*) const;
+	size_t DaysWithVisits() const;
+	// visits with game time in [fromTime, toTime), in time order
+	std::vector<VisitedPlace> VisitsBetween(const float fromTime, const float toTime) const;
 
 private:
+	void MarkKnown(const RE::BGSLocation* location);
+	static unsigned int DayOf(const float gameTime);
+
 	static std::unique_ptr<VisitedPlaces> m_instance;
-	std::vector<VisitedPlace> m_visited;
+	// append-only log chunked by game day, ascending - doubles as the day index for range queries
+	std::vector<VisitedDay> m_days;
 	std::unordered_set<const RE::BGSLocation*> m_knownLocations;
 	mutable RecursiveLock m_visitedLock;
+	std::atomic<uint64_t> m_generation = 0;
+	// advances when the history is replaced, so a chunk encoded from an older history is not kept
+	uint64_t m_historyVersion = 0;
 };
 
 void to_json(nlohmann::json& j, const VisitedPlaces& visitedPlaces);